@@ -0,0 +1,76 @@
+//
+//  OHBenchmarkRunner.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Creates the input of one iteration, outside of the measured time
+ */
+typedef id _Nonnull (^OHBenchmarkSetupBlock)(void);
+
+/**
+ *  The measured work of one iteration
+ */
+typedef void (^OHBenchmarkBlock)(id input);
+
+/**
+ *  Runs benchmark cases and collects their timings
+ */
+@interface OHBenchmarkRunner : NSObject
+
+- (instancetype)initWithIterations:(NSUInteger)iterations NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Number of measured iterations of each case, after one warm up iteration
+ */
+@property (nonatomic, readonly) NSUInteger iterations;
+
+/**
+ *  Only cases whose name contains this string are run (optional)
+ */
+@property (nonatomic, nullable, copy) NSString *filter;
+
+/**
+ *  Runs one case and records its timings
+ *
+ *  @param name         Name of the case, stable across runs so results can be compared
+ *  @param contactCount Number of contacts in the input
+ *  @param setupBlock   Creates a fresh input for each iteration, since most post processors modify the contacts they process
+ *  @param block        The work to measure
+ */
+- (void)runCaseWithName:(NSString *)name contactCount:(NSUInteger)contactCount setup:(OHBenchmarkSetupBlock)setupBlock block:(OHBenchmarkBlock)block;
+
+/**
+ *  Results of every case run so far, as JSON
+ */
+- (nullable NSData *)JSONDataWithError:(NSError *_Nullable *_Nullable)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
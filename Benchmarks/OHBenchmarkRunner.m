@@ -0,0 +1,101 @@
+//
+//  OHBenchmarkRunner.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHBenchmarkRunner.h"
+
+static const NSUInteger kOHBenchmarkResultsSchemaVersion = 1;
+
+@interface OHBenchmarkRunner ()
+
+@property (nonatomic) NSMutableArray<NSDictionary<NSString *, id> *> *results;
+
+@end
+
+@implementation OHBenchmarkRunner
+
+- (instancetype)initWithIterations:(NSUInteger)iterations
+{
+    if (self = [super init]) {
+        _iterations = MAX(iterations, 1);
+        _results = [[NSMutableArray<NSDictionary<NSString *, id> *> alloc] init];
+    }
+    return self;
+}
+
+- (void)runCaseWithName:(NSString *)name contactCount:(NSUInteger)contactCount setup:(OHBenchmarkSetupBlock)setupBlock block:(OHBenchmarkBlock)block
+{
+    if (self.filter.length && [name rangeOfString:self.filter].location == NSNotFound) {
+        return;
+    }
+
+    NSMutableArray<NSNumber *> *durations = [[NSMutableArray<NSNumber *> alloc] initWithCapacity:self.iterations];
+    for (NSUInteger iteration = 0; iteration <= self.iterations; iteration++) {
+        @autoreleasepool {
+            id input = setupBlock();
+            NSTimeInterval startTime = [NSProcessInfo processInfo].systemUptime;
+            block(input);
+            NSTimeInterval duration = [NSProcessInfo processInfo].systemUptime - startTime;
+            // The first iteration warms up caches and lazily created state and is not recorded
+            if (iteration > 0) {
+                [durations addObject:@(duration)];
+            }
+        }
+    }
+
+    NSArray<NSNumber *> *sortedDurations = [durations sortedArrayUsingSelector:@selector(compare:)];
+    double totalDuration = 0;
+    for (NSNumber *duration in sortedDurations) {
+        totalDuration += duration.doubleValue;
+    }
+    NSDictionary<NSString *, id> *result = @{@"name": name,
+                                             @"contactCount": @(contactCount),
+                                             @"iterations": @(sortedDurations.count),
+                                             @"minSeconds": sortedDurations.firstObject,
+                                             @"medianSeconds": [sortedDurations objectAtIndex:sortedDurations.count / 2],
+                                             @"meanSeconds": @(totalDuration / sortedDurations.count),
+                                             @"maxSeconds": sortedDurations.lastObject};
+    [self.results addObject:result];
+
+    fprintf(stderr, "%-48s %8lu contacts  median %10.3f ms\n", name.UTF8String, (unsigned long)contactCount, [[result objectForKey:@"medianSeconds"] doubleValue] * 1000);
+}
+
+- (NSData *)JSONDataWithError:(NSError **)error
+{
+    NSProcessInfo *processInfo = [NSProcessInfo processInfo];
+    NSDateFormatter *dateFormatter = [[NSDateFormatter alloc] init];
+    dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+    dateFormatter.timeZone = [NSTimeZone timeZoneWithAbbreviation:@"UTC"];
+    dateFormatter.dateFormat = @"yyyy-MM-dd'T'HH:mm:ss'Z'";
+
+    NSDictionary<NSString *, id> *report = @{@"schemaVersion": @(kOHBenchmarkResultsSchemaVersion),
+                                             @"date": [dateFormatter stringFromDate:[NSDate date]],
+                                             @"host": @{@"operatingSystem": processInfo.operatingSystemVersionString,
+                                                        @"processorCount": @(processInfo.activeProcessorCount),
+                                                        @"physicalMemory": @(processInfo.physicalMemory)},
+                                             @"results": self.results};
+    return [NSJSONSerialization dataWithJSONObject:report options:NSJSONWritingPrettyPrinted error:error];
+}
+
+@end
@@ -0,0 +1,230 @@
+//
+//  main.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+#import <Ohana/OHAlphabeticalSortPostProcessor.h>
+#import <Ohana/OHCompositeAndPostProcessor.h>
+#import <Ohana/OHCompositeOrPostProcessor.h>
+#import <Ohana/OHCompositeXorPostProcessor.h>
+#import <Ohana/OHContactsDataSource.h>
+#import <Ohana/OHDigitSearchUtility.h>
+#import <Ohana/OHFuzzyMatchingUtility.h>
+#import <Ohana/OHPhoneNumberFormattingPostProcessor.h>
+#import <Ohana/OHRequiredFieldPostProcessor.h>
+#import <Ohana/OHSplitOnFieldTypePostProcessor.h>
+#import <Ohana/OHSyntheticContactsDataProvider.h>
+
+#import "OHBenchmarkContactsDataProvider.h"
+#import "OHBenchmarkRunner.h"
+
+static const uint64_t kOHBenchmarkSeed = 20160401;
+
+/**
+ *  Usage: OhanaBenchmarks [-sizes 1000,10000,100000] [-iterations 5] [-filter name] [-output results.json]
+ */
+int main(int argc, const char *argv[])
+{
+    @autoreleasepool {
+        // Arguments are read through the argument domain of NSUserDefaults
+        NSUserDefaults *arguments = [NSUserDefaults standardUserDefaults];
+        NSString *sizesArgument = [arguments stringForKey:@"sizes"] ?: @"1000,10000,100000";
+        NSInteger iterations = [arguments integerForKey:@"iterations"] ?: 5;
+        NSString *outputPath = [arguments stringForKey:@"output"];
+
+        OHBenchmarkRunner *runner = [[OHBenchmarkRunner alloc] initWithIterations:(NSUInteger)MAX(iterations, 1)];
+        runner.filter = [arguments stringForKey:@"filter"];
+
+        for (NSString *sizeArgument in [sizesArgument componentsSeparatedByString:@","]) {
+            NSUInteger contactCount = (NSUInteger)MAX(sizeArgument.integerValue, 0);
+            if (!contactCount) {
+                continue;
+            }
+
+            // Read-only cases share one book, cases that modify their input get a fresh one for each iteration
+            OHSyntheticContactsDataProvider *syntheticDataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:contactCount seed:kOHBenchmarkSeed];
+            NSOrderedSet<OHContact *> *sharedContacts = [syntheticDataProvider fetchContactsWithIdentifiers:nil error:nil];
+            OHBenchmarkSetupBlock sharedContactsBlock = ^id {
+                return sharedContacts;
+            };
+            OHBenchmarkSetupBlock freshContactsBlock = ^id {
+                return [syntheticDataProvider fetchContactsWithIdentifiers:nil error:nil];
+            };
+
+            [runner runCaseWithName:@"dataSource.loadContacts" contactCount:contactCount setup:freshContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                OHBenchmarkContactsDataProvider *dataProvider = [[OHBenchmarkContactsDataProvider alloc] initWithContacts:contacts];
+                NSOrderedSet<id<OHContactsPostProcessorProtocol>> *postProcessors = [NSOrderedSet orderedSetWithObjects:[[OHRequiredFieldPostProcessor alloc] initWithFieldType:OHContactFieldTypePhoneNumber],
+                                                                                                                        [[OHPhoneNumberFormattingPostProcessor alloc] initWithFormats:OHPhoneNumberFormatE164 | OHPhoneNumberFormatNational],
+                                                                                                                        [[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeFullName],
+                                                                                                                        nil];
+                OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:[NSOrderedSet orderedSetWithObject:dataProvider] postProcessors:postProcessors];
+                // Serial loading with inline processing delivers the ready signal before loadContacts returns
+                [dataSource loadContacts];
+                NSCAssert(dataSource.contacts != nil, @"The data source should be ready");
+            }];
+
+            // Time to ready including generating the contacts, as a stand-in for reading a contact store, with batches processed while loading
+            OHBenchmarkSetupBlock syntheticDataProviderBlock = ^id {
+                OHSyntheticContactsDataProvider *dataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:contactCount seed:kOHBenchmarkSeed];
+                dataProvider.batchSize = 500;
+                return dataProvider;
+            };
+            [runner runCaseWithName:@"dataSource.loadContacts.synthetic" contactCount:contactCount setup:syntheticDataProviderBlock block:^(OHSyntheticContactsDataProvider *dataProvider) {
+                NSOrderedSet<id<OHContactsPostProcessorProtocol>> *postProcessors = [NSOrderedSet orderedSetWithObject:[[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeFullName]];
+                OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:[NSOrderedSet orderedSetWithObject:dataProvider] postProcessors:postProcessors];
+                dataSource.loadingMode = OHContactsDataSourceLoadingModeConcurrent;
+                dataSource.processingMode = OHContactsDataSourceProcessingModeBackground;
+                dispatch_semaphore_t readySemaphore = dispatch_semaphore_create(0);
+                [dataSource.onContactsDataSourceReadySignal addObserver:dataSource callback:^(id self, NSOrderedSet<OHContact *> *contacts) {
+                    dispatch_semaphore_signal(readySemaphore);
+                }];
+                [dataSource loadContacts];
+                dispatch_semaphore_wait(readySemaphore, DISPATCH_TIME_FOREVER);
+            }];
+
+            [runner runCaseWithName:@"alphabeticalSort.fullName" contactCount:contactCount setup:sharedContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeFullName] processContacts:contacts];
+            }];
+
+            [runner runCaseWithName:@"alphabeticalSort.lastName" contactCount:contactCount setup:sharedContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeLastName] processContacts:contacts];
+            }];
+
+            [runner runCaseWithName:@"phoneNumberFormatting.e164National" contactCount:contactCount setup:freshContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[[OHPhoneNumberFormattingPostProcessor alloc] initWithFormats:OHPhoneNumberFormatE164 | OHPhoneNumberFormatNational] processContacts:contacts];
+            }];
+
+            [runner runCaseWithName:@"splitOnFieldType.phoneNumber" contactCount:contactCount setup:sharedContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[[OHSplitOnFieldTypePostProcessor alloc] initWithFieldType:OHContactFieldTypePhoneNumber] processContacts:contacts];
+            }];
+
+            NSOrderedSet<id<OHContactsPostProcessorProtocol>> *requiredFieldPostProcessors = [NSOrderedSet orderedSetWithObjects:[[OHRequiredFieldPostProcessor alloc] initWithFieldType:OHContactFieldTypePhoneNumber],
+                                                                                                                                 [[OHRequiredFieldPostProcessor alloc] initWithFieldType:OHContactFieldTypeEmailAddress],
+                                                                                                                                 nil];
+            [runner runCaseWithName:@"compositeAnd.phoneNumberEmailAddress" contactCount:contactCount setup:sharedContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[[OHCompositeAndPostProcessor alloc] initWithPostProcessors:requiredFieldPostProcessors] processContacts:contacts];
+            }];
+
+            [runner runCaseWithName:@"compositeOr.phoneNumberEmailAddress" contactCount:contactCount setup:sharedContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[[OHCompositeOrPostProcessor alloc] initWithPostProcessors:requiredFieldPostProcessors] processContacts:contacts];
+            }];
+
+            [runner runCaseWithName:@"compositeXor.phoneNumberEmailAddress" contactCount:contactCount setup:sharedContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[[OHCompositeXorPostProcessor alloc] initWithPostProcessors:requiredFieldPostProcessors] processContacts:contacts];
+            }];
+
+            OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:sharedContacts];
+            OHBenchmarkSetupBlock fuzzyMatchingUtilityBlock = ^id {
+                return fuzzyMatchingUtility;
+            };
+            OHFuzzyMatchingUtility *indexedFuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:sharedContacts indexingMode:OHFuzzyMatchingIndexingModeInline];
+            OHBenchmarkSetupBlock indexedFuzzyMatchingUtilityBlock = ^id {
+                return indexedFuzzyMatchingUtility;
+            };
+            for (NSString *query in @[@"j", @"jsmth", @"415"]) {
+                // The search session would answer repeated queries without searching
+                [runner runCaseWithName:[NSString stringWithFormat:@"fuzzyMatching.query.%@", query] contactCount:contactCount setup:fuzzyMatchingUtilityBlock block:^(OHFuzzyMatchingUtility *utility) {
+                    [utility resetSearchSession];
+                    [utility contactsMatchingQuery:query];
+                }];
+                [runner runCaseWithName:[NSString stringWithFormat:@"fuzzyMatching.indexedQuery.%@", query] contactCount:contactCount setup:indexedFuzzyMatchingUtilityBlock block:^(OHFuzzyMatchingUtility *utility) {
+                    [utility resetSearchSession];
+                    [utility contactsMatchingQuery:query];
+                }];
+            }
+
+            [runner runCaseWithName:@"fuzzyMatching.typeAhead.jsmth" contactCount:contactCount setup:fuzzyMatchingUtilityBlock block:^(OHFuzzyMatchingUtility *utility) {
+                [utility resetSearchSession];
+                for (NSString *query in @[@"j", @"js", @"jsm", @"jsmt", @"jsmth"]) {
+                    [utility contactsMatchingQuery:query];
+                }
+            }];
+
+            OHFuzzyMatchingUtility *scoringBlockFuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:sharedContacts];
+            scoringBlockFuzzyMatchingUtility.scoringBlock = ^NSInteger (NSString *query, NSString *nominee) {
+                return [nominee.lowercaseString hasPrefix:query.lowercaseString] ? 1 : 0;
+            };
+            OHBenchmarkSetupBlock scoringBlockFuzzyMatchingUtilityBlock = ^id {
+                return scoringBlockFuzzyMatchingUtility;
+            };
+            OHFuzzyMatchingUtility *builtInScoringFuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:sharedContacts];
+            builtInScoringFuzzyMatchingUtility.usesBuiltInScoring = YES;
+            OHBenchmarkSetupBlock builtInScoringFuzzyMatchingUtilityBlock = ^id {
+                return builtInScoringFuzzyMatchingUtility;
+            };
+            for (NSString *query in @[@"j", @"jsmth"]) {
+                [runner runCaseWithName:[NSString stringWithFormat:@"fuzzyMatching.scoringBlock.%@", query] contactCount:contactCount setup:scoringBlockFuzzyMatchingUtilityBlock block:^(OHFuzzyMatchingUtility *utility) {
+                    [utility resetSearchSession];
+                    [utility contactsMatchingQuery:query];
+                }];
+                [runner runCaseWithName:[NSString stringWithFormat:@"fuzzyMatching.builtInScoring.%@", query] contactCount:contactCount setup:builtInScoringFuzzyMatchingUtilityBlock block:^(OHFuzzyMatchingUtility *utility) {
+                    [utility resetSearchSession];
+                    [utility contactsMatchingQuery:query];
+                }];
+                [runner runCaseWithName:[NSString stringWithFormat:@"fuzzyMatching.builtInScoringTop50.%@", query] contactCount:contactCount setup:builtInScoringFuzzyMatchingUtilityBlock block:^(OHFuzzyMatchingUtility *utility) {
+                    [utility resetSearchSession];
+                    [utility contactsMatchingQuery:query limit:50];
+                }];
+            }
+
+            OHDigitSearchUtility *digitSearchUtility = [[OHDigitSearchUtility alloc] initWithContacts:sharedContacts];
+            OHBenchmarkSetupBlock digitSearchUtilityBlock = ^id {
+                return digitSearchUtility;
+            };
+            for (NSString *digits in @[@"4", @"4155", @"5551234"]) {
+                [runner runCaseWithName:[NSString stringWithFormat:@"digitSearch.substring.%@", digits] contactCount:contactCount setup:digitSearchUtilityBlock block:^(OHDigitSearchUtility *utility) {
+                    [utility contactFieldsMatchingDigits:digits mode:OHDigitSearchModeSubstring];
+                }];
+            }
+            [runner runCaseWithName:@"digitSearch.t9Prefix.5646" contactCount:contactCount setup:digitSearchUtilityBlock block:^(OHDigitSearchUtility *utility) {
+                [utility contactsMatchingT9Digits:@"5646" mode:OHDigitSearchModePrefix];
+            }];
+            [runner runCaseWithName:@"digitSearch.build" contactCount:contactCount setup:sharedContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[OHDigitSearchUtility alloc] initWithContacts:contacts];
+            }];
+
+            [runner runCaseWithName:@"fuzzyMatching.buildIndex" contactCount:contactCount setup:sharedContactsBlock block:^(NSOrderedSet<OHContact *> *contacts) {
+                [[OHFuzzyMatchingUtility alloc] initWithContacts:contacts indexingMode:OHFuzzyMatchingIndexingModeInline];
+            }];
+        }
+
+        NSError *error;
+        NSData *JSONData = [runner JSONDataWithError:&error];
+        if (!JSONData) {
+            fprintf(stderr, "Could not encode the results: %s\n", error.localizedDescription.UTF8String);
+            return 1;
+        }
+        if (outputPath) {
+            if (![JSONData writeToFile:outputPath options:NSDataWritingAtomic error:&error]) {
+                fprintf(stderr, "Could not write %s: %s\n", outputPath.UTF8String, error.localizedDescription.UTF8String);
+                return 1;
+            }
+        } else {
+            fwrite(JSONData.bytes, 1, JSONData.length, stdout);
+            fputc('\n', stdout);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,39 @@
+#!/bin/sh
+#
+# Builds the Ohana benchmarks as a macOS command line tool against Foundation only and runs them.
+# Arguments are passed to the benchmarks, for example: ./run_benchmarks.sh -sizes 1000,10000 -output results.json
+#
+set -e
+
+BENCHMARKS_DIR="$(cd "$(dirname "$0")" && pwd)"
+ROOT_DIR="$(dirname "$BENCHMARKS_DIR")"
+PODS_DIR="$ROOT_DIR/Example/Pods"
+BUILD_DIR="$BENCHMARKS_DIR/build"
+
+if [ ! -d "$PODS_DIR/UberSignals" ] || [ ! -d "$PODS_DIR/libPhoneNumber-iOS" ]; then
+    echo "Run 'pod install' in Example first" >&2
+    exit 1
+fi
+
+# Lay out the headers the way the frameworks would expose them
+rm -rf "$BUILD_DIR/include"
+mkdir -p "$BUILD_DIR/include/Ohana"
+find "$ROOT_DIR/Ohana/Classes" -name '*.h' -exec ln -s {} "$BUILD_DIR/include/Ohana/" \;
+ln -s "$PODS_DIR/UberSignals/UberSignals" "$BUILD_DIR/include/UberSignals"
+ln -s "$PODS_DIR/libPhoneNumber-iOS/libPhoneNumber" "$BUILD_DIR/include/libPhoneNumber_iOS"
+
+# Other data providers, the change sources and the statistics post processor need the AddressBook and Contacts frameworks, and are not benchmarked
+SOURCES="$(find "$ROOT_DIR/Ohana/Classes/Core" "$ROOT_DIR/Ohana/Classes/Common/PostProcessors" "$ROOT_DIR/Ohana/Classes/Utilities" -name '*.m' ! -name 'OHStatisticsPostProcessor.m')
+$ROOT_DIR/Ohana/Classes/Common/DataProviders/OHSyntheticContactsDataProvider.m
+$(find "$PODS_DIR/UberSignals/UberSignals" -name '*.m')
+$(find "$PODS_DIR/libPhoneNumber-iOS/libPhoneNumber" -name '*.m' ! -name '*Test*')
+$(find "$BENCHMARKS_DIR" -maxdepth 1 -name '*.m')"
+
+# shellcheck disable=SC2086
+xcrun clang -fobjc-arc -O2 \
+    -I "$BUILD_DIR/include" -I "$BUILD_DIR/include/Ohana" \
+    -framework Foundation \
+    -o "$BUILD_DIR/OhanaBenchmarks" \
+    $SOURCES
+
+"$BUILD_DIR/OhanaBenchmarks" "$@"
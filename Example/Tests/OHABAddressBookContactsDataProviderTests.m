@@ -36,6 +36,8 @@ typedef void (^OHABContactsFetchFailedBlock)(NSError *error);
 
 - (ABAuthorizationStatus)_authorizationStatus;
 - (void)_fetchContactsWithSuccess:(OHABContactsFetchCompletionBlock)success failure:(OHABContactsFetchFailedBlock)failure;
+- (void)_readAddressBookContacts:(ABAddressBookRef)addressBook completion:(void (^)(NSOrderedSet<OHContact *> *records))completion;
+- (CFArrayRef)_copyArrayOfAllPeopleFromAddressBook:(ABAddressBookRef)addressBook;
 
 @end
 
@@ -68,6 +70,36 @@ typedef void (^OHABContactsFetchFailedBlock)(NSError *error);
     XCTAssertTrue([[OHABAddressBookContactsDataProvider providerIdentifier] isEqualToString:NSStringFromClass([OHABAddressBookContactsDataProvider class])]);
 }
 
+- (void)testReadContactsInBatches
+{
+    CFMutableArrayRef peopleRecordRefs = CFArrayCreateMutable(NULL, 0, &kCFTypeArrayCallBacks);
+    for (NSUInteger i = 0; i < 5; i++) {
+        ABRecordRef record = ABPersonCreate();
+        ABRecordSetValue(record, kABPersonFirstNameProperty, (__bridge CFStringRef)[NSString stringWithFormat:@"First %lu", (unsigned long)i], NULL);
+        CFArrayAppendValue(peopleRecordRefs, record);
+        CFRelease(record);
+    }
+    // The data provider releases the array it copied, so ownership of peopleRecordRefs is handed over here
+    OCMStub([self.dataProviderMock _copyArrayOfAllPeopleFromAddressBook:[OCMArg anyPointer]]).andReturn((__bridge id)peopleRecordRefs);
+
+    [self.dataProviderMock setBatchSize:2];
+
+    NSMutableArray<NSNumber *> *batchCounts = [[NSMutableArray alloc] init];
+    [[self.dataProviderMock onContactsDataProviderBatchLoadedSignal] addObserver:self callback:^(typeof(self) self, NSOrderedSet<OHContact *> *contacts, id<OHContactsDataProviderProtocol> dataProvider) {
+        [batchCounts addObject:@(contacts.count)];
+    }];
+
+    __block NSOrderedSet<OHContact *> *records = nil;
+    [self.dataProviderMock _readAddressBookContacts:NULL completion:^(NSOrderedSet<OHContact *> *loadedRecords) {
+        records = loadedRecords;
+    }];
+
+    XCTAssertEqualObjects(batchCounts, (@[@2, @2, @1]));
+    XCTAssertEqual(records.count, 5);
+    XCTAssertEqualObjects(records.firstObject.firstName, @"First 0");
+    XCTAssertEqualObjects(records.lastObject.firstName, @"First 4");
+}
+
 - (void)testLoadContactsAuthChallenge
 {
     self.authenticationRequestExpectation = [self expectationWithDescription:@"Data provider should fire the auth challenge signal"];
@@ -128,4 +128,73 @@
     XCTAssert([result isEqualToOrderedSet:expectedResult]);
 }
 
+- (void)testSortUsesLocaleCollation
+{
+    OHContact *lowercaseContact = [[OHContact alloc] init];
+    lowercaseContact.fullName = @"bob";
+    OHContact *accentedContact = [[OHContact alloc] init];
+    accentedContact.fullName = @"\u00c9mile";
+    OHContact *uppercaseContact = [[OHContact alloc] init];
+    uppercaseContact.fullName = @"Zoe";
+
+    OHAlphabeticalSortPostProcessor *postProcessor = [[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeFullName];
+    postProcessor.locale = [NSLocale localeWithLocaleIdentifier:@"en_US"];
+    NSOrderedSet<OHContact *> *result = [postProcessor processContacts:NSOrderedSetMake(uppercaseContact, accentedContact, lowercaseContact)];
+    NSOrderedSet<OHContact *> *expectedResult = NSOrderedSetMake(lowercaseContact, accentedContact, uppercaseContact);
+    XCTAssert([result isEqualToOrderedSet:expectedResult]);
+}
+
+- (void)testLargeSortIsStable
+{
+    NSArray<NSString *> *names = @[@"Ana", @"ana", @"Bo", @"Chloe", @"", @"Dmitri"];
+    NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
+    for (NSUInteger i = 0; i < 10000; i++) {
+        OHContact *contact = [[OHContact alloc] init];
+        contact.firstName = names[(i * 7) % names.count];
+        contact.lastName = names[(i * 3) % names.count];
+        [contacts addObject:contact];
+    }
+
+    NSLocale *locale = [NSLocale localeWithLocaleIdentifier:@"en_US"];
+    NSComparisonResult (^compareNames)(NSString *, NSString *) = ^NSComparisonResult(NSString *name1, NSString *name2) {
+        if (!name1.length) {
+            return name2.length ? NSOrderedDescending : NSOrderedSame;
+        } else if (!name2.length) {
+            return NSOrderedAscending;
+        }
+        return [name1 compare:name2 options:0 range:NSMakeRange(0, name1.length) locale:locale];
+    };
+    NSArray<OHContact *> *expectedResult = [contacts.array sortedArrayWithOptions:NSSortStable usingComparator:^NSComparisonResult(OHContact *contact1, OHContact *contact2) {
+        NSComparisonResult comparison = compareNames(contact1.firstName, contact2.firstName);
+        return comparison != NSOrderedSame ? comparison : compareNames(contact1.lastName, contact2.lastName);
+    }];
+
+    OHAlphabeticalSortPostProcessor *postProcessor = [[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeFirstName];
+    postProcessor.locale = locale;
+    NSOrderedSet<OHContact *> *result = [postProcessor processContacts:contacts];
+    XCTAssertEqualObjects(result.array, expectedResult);
+}
+
+- (void)testSortOfReorderedContactsIsStable
+{
+    OHContact *contact1 = [[OHContact alloc] init];
+    contact1.fullName = @"Same Name";
+    contact1.firstName = @"first";
+    OHContact *contact2 = [[OHContact alloc] init];
+    contact2.fullName = @"Same Name";
+    contact2.firstName = @"second";
+    OHContact *contact3 = [[OHContact alloc] init];
+    contact3.fullName = @"Same Name";
+    contact3.firstName = @"third";
+
+    OHContactsIndexVector *indexVector = [[OHContactsIndexVector alloc] initWithContacts:NSOrderedSetMake(contact1, contact2, contact3)];
+    OHContactsIndexVector *reversedIndexVector = [[[OHReverseOrderPostProcessor alloc] init] processIndexVector:indexVector];
+    OHAlphabeticalSortPostProcessor *postProcessor = [[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeFullName];
+
+    // Equal names keep the order of the sort's input, which is the reversed order, not the order of the base contacts
+    NSOrderedSet<OHContact *> *result = [[postProcessor processIndexVector:reversedIndexVector] contacts];
+    NSOrderedSet<OHContact *> *expectedResult = NSOrderedSetMake(contact3, contact2, contact1);
+    XCTAssert([result isEqualToOrderedSet:expectedResult]);
+}
+
 @end
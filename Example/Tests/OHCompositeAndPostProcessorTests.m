@@ -109,4 +109,49 @@
     XCTAssert([result isEqualToOrderedSet:expectedResult]);
 }
 
+- (void)testStopsWhenSubprocessorKeepsNoContacts
+{
+    __block NSOrderedSet<OHContact *> *arrayContactA = NSOrderedSetMake(self.testContacts[0]);
+    __block NSOrderedSet<OHContact *> *arrayContactEmpty = [NSOrderedSet orderedSet];
+
+    id<OHContactsPostProcessorProtocol> processorA = OCMProtocolMock(@protocol(OHContactsPostProcessorProtocol));
+    OCMStub([processorA processContacts:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        [invocation setReturnValue:&arrayContactA];
+    });
+
+    id<OHContactsPostProcessorProtocol> processorB = OCMProtocolMock(@protocol(OHContactsPostProcessorProtocol));
+    OCMStub([processorB processContacts:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        [invocation setReturnValue:&arrayContactEmpty];
+    });
+
+    id<OHContactsPostProcessorProtocol> processorC = OCMStrictProtocolMock(@protocol(OHContactsPostProcessorProtocol));
+
+    OHCompositeAndPostProcessor *compositeProcessor = [[OHCompositeAndPostProcessor alloc] initWithPostProcessors:NSOrderedSetMake(processorA, processorB, processorC)];
+
+    XCTAssertNil([compositeProcessor processContacts:self.testContacts]);
+}
+
+- (void)testSubprocessorsReceiveAllContacts
+{
+    OHRequiredFieldPostProcessor *phoneProcessor = [[OHRequiredFieldPostProcessor alloc] initWithFieldType:OHContactFieldTypePhoneNumber];
+
+    __block NSOrderedSet<OHContact *> *receivedContacts;
+    id<OHContactsPostProcessorProtocol> processorB = OCMProtocolMock(@protocol(OHContactsPostProcessorProtocol));
+    OCMStub([processorB processContacts:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __unsafe_unretained NSOrderedSet<OHContact *> *preProcessedContacts;
+        [invocation getArgument:&preProcessedContacts atIndex:2];
+        receivedContacts = preProcessedContacts;
+        [invocation setReturnValue:&preProcessedContacts];
+    });
+
+    self.testContacts[1].contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"home" value:@"5555555555" dataProviderIdentifier:@"test"]);
+
+    OHCompositeAndPostProcessor *compositeProcessor = [[OHCompositeAndPostProcessor alloc] initWithPostProcessors:NSOrderedSetMake(phoneProcessor, processorB)];
+
+    NSOrderedSet<OHContact *> *result = [compositeProcessor processContacts:self.testContacts];
+    NSOrderedSet<OHContact *> *expectedResult = NSOrderedSetMake(self.testContacts[1]);
+    XCTAssert([receivedContacts isEqualToOrderedSet:self.testContacts]);
+    XCTAssert([result isEqualToOrderedSet:expectedResult]);
+}
+
 @end
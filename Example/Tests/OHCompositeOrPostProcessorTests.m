@@ -87,4 +87,53 @@
     XCTAssert([result isEqualToOrderedSet:expectedResult]);
 }
 
+- (void)testCompositeOrConcurrently
+{
+    OHRequiredFieldPostProcessor *phoneProcessor = [[OHRequiredFieldPostProcessor alloc] initWithFieldType:OHContactFieldTypePhoneNumber];
+    OHRequiredFieldPostProcessor *emailProcessor = [[OHRequiredFieldPostProcessor alloc] initWithFieldType:OHContactFieldTypeEmailAddress];
+
+    self.testContacts[0].contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"home" value:@"a@example.com" dataProviderIdentifier:@"test"]);
+    self.testContacts[2].contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"home" value:@"5555555555" dataProviderIdentifier:@"test"]);
+
+    OHCompositeOrPostProcessor *compositeProcessor = [[OHCompositeOrPostProcessor alloc] initWithPostProcessors:NSOrderedSetMake(phoneProcessor, emailProcessor)];
+    compositeProcessor.runsPostProcessorsConcurrently = YES;
+
+    NSOrderedSet<OHContact *> *result = [compositeProcessor processContacts:self.testContacts];
+    NSOrderedSet<OHContact *> *expectedResult = NSOrderedSetMake(self.testContacts[2], self.testContacts[0]);
+    XCTAssert([result isEqualToOrderedSet:expectedResult]);
+}
+
+- (void)testCompositeOrWithSplit
+{
+    OHSplitOnFieldTypePostProcessor *splitProcessor = [[OHSplitOnFieldTypePostProcessor alloc] initWithFieldType:OHContactFieldTypePhoneNumber];
+    OHRequiredFieldPostProcessor *emailProcessor = [[OHRequiredFieldPostProcessor alloc] initWithFieldType:OHContactFieldTypeEmailAddress];
+
+    self.testContacts[0].contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"home" value:@"a@example.com" dataProviderIdentifier:@"test"]);
+    self.testContacts[2].contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"home" value:@"5555555555" dataProviderIdentifier:@"test"],
+                                                          [[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"work" value:@"5555555556" dataProviderIdentifier:@"test"]);
+
+    OHCompositeOrPostProcessor *compositeProcessor = [[OHCompositeOrPostProcessor alloc] initWithPostProcessors:NSOrderedSetMake(splitProcessor, emailProcessor)];
+
+    // The split returns new contacts, one per phone number, which the result must keep alongside the contacts from the other post processor
+    NSOrderedSet<OHContact *> *result = [compositeProcessor processContacts:self.testContacts];
+    XCTAssertEqual(result.count, (NSUInteger)3);
+    XCTAssertEqual(result[0].contactFields[0], self.testContacts[2].contactFields[0]);
+    XCTAssertEqual(result[1].contactFields[0], self.testContacts[2].contactFields[1]);
+    XCTAssertEqual(result[2], self.testContacts[0]);
+}
+
+- (void)testConfigurationFingerprint
+{
+    OHCompositeOrPostProcessor *compositeProcessor = [[OHCompositeOrPostProcessor alloc] initWithPostProcessors:NSOrderedSetMake([[OHReverseOrderPostProcessor alloc] init], [[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeFullName])];
+    OHCompositeOrPostProcessor *equalCompositeProcessor = [[OHCompositeOrPostProcessor alloc] initWithPostProcessors:NSOrderedSetMake([[OHReverseOrderPostProcessor alloc] init], [[OHAlphabeticalSortPostProcessor alloc] initWithSortMode:OHAlphabeticalSortPostProcessorSortModeFullName])];
+    XCTAssertNotNil([compositeProcessor configurationFingerprint]);
+    XCTAssertEqualObjects([compositeProcessor configurationFingerprint], [equalCompositeProcessor configurationFingerprint]);
+
+    // A post processor without a fingerprint may be reconfigured in place, so the composite must always run
+    id<OHContactsPostProcessorProtocol> processorWithoutFingerprint = OCMProtocolMock(@protocol(OHContactsPostProcessorProtocol));
+    OCMStub([processorWithoutFingerprint configurationFingerprint]).andReturn(nil);
+    OHCompositeOrPostProcessor *unfingerprintedCompositeProcessor = [[OHCompositeOrPostProcessor alloc] initWithPostProcessors:NSOrderedSetMake([[OHReverseOrderPostProcessor alloc] init], processorWithoutFingerprint)];
+    XCTAssertNil([unfingerprintedCompositeProcessor configurationFingerprint]);
+}
+
 @end
@@ -0,0 +1,125 @@
+//
+//  OHContactProjectionTests.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <XCTest/XCTest.h>
+#import <Ohana/Ohana.h>
+
+#import "NSOrderedSetMake+Internal.h"
+
+@interface OHContactProjectionTests : XCTestCase
+
+@property (nonatomic) OHContact *contact;
+
+@end
+
+@implementation OHContactProjectionTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    self.contact = [[OHContact alloc] init];
+    self.contact.fullName = @"Full Name";
+    self.contact.firstName = @"First";
+    self.contact.lastName = @"Last";
+    self.contact.organizationName = @"Organization";
+    self.contact.jobTitle = @"Job Title";
+    self.contact.departmentName = @"Department";
+    self.contact.contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"phone" value:@"555" dataProviderIdentifier:@"test"],
+                                                  [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"email" value:@"a@b.c" dataProviderIdentifier:@"test"]);
+    self.contact.postalAddresses = NSOrderedSetMake([[OHContactAddress alloc] initWithLabel:@"address" street:@"test" city:@"test" state:@"test" postalCode:@"test" country:@"country" dataProviderIdentifier:@"test"]);
+    [self.contact.tags addObject:@"TestTag"];
+    [self.contact.customProperties setObject:@"TestProperty" forKey:@"TestPropertyKey"];
+}
+
+- (void)testReadsAreForwarded
+{
+    OHContactProjection *projection = [[OHContactProjection alloc] initWithContact:self.contact contactField:self.contact.contactFields[1]];
+
+    XCTAssertEqual(projection.contact, self.contact);
+    XCTAssertEqual(projection.fullName, self.contact.fullName);
+    XCTAssertEqual(projection.firstName, self.contact.firstName);
+    XCTAssertEqual(projection.lastName, self.contact.lastName);
+    XCTAssertEqual(projection.organizationName, self.contact.organizationName);
+    XCTAssertEqual(projection.jobTitle, self.contact.jobTitle);
+    XCTAssertEqual(projection.departmentName, self.contact.departmentName);
+    XCTAssertEqual(projection.postalAddresses, self.contact.postalAddresses);
+    XCTAssertEqualObjects(projection.tags, self.contact.tags);
+    XCTAssertEqualObjects(projection.customProperties, self.contact.customProperties);
+
+    XCTAssertEqual(projection.contactFields.count, (NSUInteger)1);
+    XCTAssertEqual(projection.contactFields[0], self.contact.contactFields[1]);
+    XCTAssertEqual(projection.contactFieldTypes, OHContactFieldTypeMaskEmailAddress);
+    XCTAssertTrue([projection hasContactFieldOfType:OHContactFieldTypeEmailAddress]);
+    XCTAssertFalse([projection hasContactFieldOfType:OHContactFieldTypePhoneNumber]);
+    XCTAssertEqual([projection numberOfContactFieldsOfType:OHContactFieldTypeEmailAddress], (NSUInteger)1);
+}
+
+- (void)testEqualToSplitCopy
+{
+    OHContactProjection *projection = [[OHContactProjection alloc] initWithContact:self.contact contactField:self.contact.contactFields[0]];
+    OHContact *splitCopy = [self.contact copy];
+    splitCopy.contactFields = [NSOrderedSet orderedSetWithObject:self.contact.contactFields[0]];
+
+    XCTAssertEqual(projection.contentFingerprint, splitCopy.contentFingerprint);
+    XCTAssertTrue([projection isEqualToContact:splitCopy]);
+    XCTAssertTrue([splitCopy isEqualToContact:projection]);
+}
+
+- (void)testWritesStayOnProjection
+{
+    OHContactProjection *projection = [[OHContactProjection alloc] initWithContact:self.contact contactField:self.contact.contactFields[0]];
+    OHContentFingerprint fingerprint = projection.contentFingerprint;
+
+    projection.firstName = @"Other";
+    projection.contactFields = self.contact.contactFields;
+    [projection.tags addObject:@"OtherTag"];
+    [projection.customProperties setObject:@"OtherProperty" forKey:@"OtherPropertyKey"];
+
+    XCTAssertEqualObjects(projection.firstName, @"Other");
+    XCTAssertEqual(projection.contactFields.count, (NSUInteger)2);
+    XCTAssertEqual(projection.contactFieldTypes, OHContactFieldTypeMaskPhoneNumber | OHContactFieldTypeMaskEmailAddress);
+    XCTAssertEqual(projection.tags.count, (NSUInteger)2);
+    XCTAssertNotEqual(projection.contentFingerprint, fingerprint);
+
+    XCTAssertEqualObjects(self.contact.firstName, @"First");
+    XCTAssertEqual(self.contact.tags.count, (NSUInteger)1);
+    XCTAssertNil([self.contact.customProperties objectForKey:@"OtherPropertyKey"]);
+
+    projection.lastName = nil;
+    XCTAssertNil(projection.lastName);
+    XCTAssertEqualObjects(self.contact.lastName, @"Last");
+}
+
+- (void)testCopyIsRegularContact
+{
+    OHContactProjection *projection = [[OHContactProjection alloc] initWithContact:self.contact contactField:self.contact.contactFields[0]];
+    OHContact *copy = [projection copy];
+
+    XCTAssertEqual([copy class], [OHContact class]);
+    XCTAssertTrue([copy isEqualToContact:projection]);
+}
+
+@end
@@ -82,6 +82,115 @@
     XCTAssertEqualObjects(self.contact.fullName, @"Full Name");
 }
 
+- (void)testContentFingerprint
+{
+    OHContact *contactCopy = [self.contact copy];
+    XCTAssertEqual(contactCopy.contentFingerprint, self.contact.contentFingerprint);
+
+    [contactCopy.tags addObject:@"TestTag3"];
+    XCTAssertEqual(contactCopy.contentFingerprint, self.contact.contentFingerprint);
+
+    contactCopy.fullName = @"Other Name";
+    XCTAssertNotEqual(contactCopy.contentFingerprint, self.contact.contentFingerprint);
+
+    contactCopy.fullName = self.contact.fullName;
+    XCTAssertEqual(contactCopy.contentFingerprint, self.contact.contentFingerprint);
+
+    contactCopy.thumbnailPhoto = [UIImage imageNamed:@"LogoClear"];
+    XCTAssertNotEqual(contactCopy.contentFingerprint, self.contact.contentFingerprint);
+
+    contactCopy.thumbnailPhoto = nil;
+    XCTAssertNotEqual(contactCopy.contentFingerprint, self.contact.contentFingerprint);
+}
+
+- (void)testContactFieldContentFingerprint
+{
+    OHContactField *contactField = [[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"phone" value:@"555" dataProviderIdentifier:@"test"];
+    OHContactField *equalContactField = [[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"phone" value:@"555" dataProviderIdentifier:@"test"];
+    OHContactField *otherContactField = [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"phone" value:@"555" dataProviderIdentifier:@"test"];
+
+    XCTAssertEqual(contactField.contentFingerprint, equalContactField.contentFingerprint);
+    XCTAssertNotEqual(contactField.contentFingerprint, otherContactField.contentFingerprint);
+}
+
+- (void)testContactFieldTypes
+{
+    OHContact *contact = [[OHContact alloc] init];
+    XCTAssertEqual(contact.contactFieldTypes, 0);
+    XCTAssertFalse([contact hasContactFieldOfType:OHContactFieldTypePhoneNumber]);
+    XCTAssertEqual([contact numberOfContactFieldsOfType:OHContactFieldTypePhoneNumber], 0);
+
+    contact.contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"home" value:@"555" dataProviderIdentifier:@"test"],
+                                             [[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"work" value:@"556" dataProviderIdentifier:@"test"],
+                                             [[OHContactField alloc] initWithType:OHContactFieldTypeURL label:@"url" value:@"http://test.test" dataProviderIdentifier:@"test"]);
+    XCTAssertEqual(contact.contactFieldTypes, OHContactFieldTypeMaskPhoneNumber | OHContactFieldTypeMaskURL);
+    XCTAssertTrue([contact hasContactFieldOfType:OHContactFieldTypePhoneNumber]);
+    XCTAssertTrue([contact hasContactFieldOfType:OHContactFieldTypeURL]);
+    XCTAssertFalse([contact hasContactFieldOfType:OHContactFieldTypeEmailAddress]);
+    XCTAssertEqual([contact numberOfContactFieldsOfType:OHContactFieldTypePhoneNumber], 2);
+    XCTAssertEqual([contact numberOfContactFieldsOfType:OHContactFieldTypeURL], 1);
+    XCTAssertEqual([contact numberOfContactFieldsOfType:OHContactFieldTypeOther], 0);
+
+    OHContact *contactCopy = [contact copy];
+    XCTAssertEqual(contactCopy.contactFieldTypes, contact.contactFieldTypes);
+    XCTAssertEqual([contactCopy numberOfContactFieldsOfType:OHContactFieldTypePhoneNumber], 2);
+
+    contact.contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"email" value:@"a@b.c" dataProviderIdentifier:@"test"]);
+    XCTAssertEqual(contact.contactFieldTypes, OHContactFieldTypeMaskEmailAddress);
+    XCTAssertEqual([contact numberOfContactFieldsOfType:OHContactFieldTypePhoneNumber], 0);
+
+    contact.contactFields = nil;
+    XCTAssertEqual(contact.contactFieldTypes, 0);
+    XCTAssertEqual([contact numberOfContactFieldsOfType:OHContactFieldTypeEmailAddress], 0);
+}
+
+- (void)testContactFieldCustomPropertyProviders
+{
+    OHContactField *contactField = [[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"phone" value:@"555" dataProviderIdentifier:@"test"];
+    __block NSInteger providerCallCount = 0;
+    contactField.customPropertyProviders = @{@"ProvidedKey": ^id(OHContactField *field) {
+        providerCallCount++;
+        return [field.value stringByAppendingString:@"!"];
+    }, @"EmptyKey": ^id(OHContactField *field) {
+        providerCallCount++;
+        return nil;
+    }};
+    [contactField.customProperties setObject:@"Stored" forKey:@"StoredKey"];
+
+    XCTAssertEqualObjects([contactField customPropertyForKey:@"StoredKey"], @"Stored");
+    XCTAssertNil([contactField customPropertyForKey:@"MissingKey"]);
+    XCTAssertEqual(providerCallCount, 0);
+
+    XCTAssertEqualObjects([contactField customPropertyForKey:@"ProvidedKey"], @"555!");
+    XCTAssertEqualObjects([contactField customPropertyForKey:@"ProvidedKey"], @"555!");
+    XCTAssertNil([contactField customPropertyForKey:@"EmptyKey"]);
+    XCTAssertNil([contactField customPropertyForKey:@"EmptyKey"]);
+    XCTAssertEqual(providerCallCount, 2);
+    XCTAssertNil([contactField.customProperties objectForKey:@"ProvidedKey"]);
+
+    OHContactField *contactFieldCopy = [contactField copy];
+    XCTAssertEqualObjects([contactFieldCopy customPropertyForKey:@"ProvidedKey"], @"555!");
+    XCTAssertEqual(providerCallCount, 2);
+
+    contactField.customPropertyProviders = @{@"ProvidedKey": ^id(OHContactField *field) {
+        providerCallCount++;
+        return [field.value stringByAppendingString:@"?"];
+    }};
+    XCTAssertEqualObjects([contactField customPropertyForKey:@"ProvidedKey"], @"555?");
+    XCTAssertNil([contactField customPropertyForKey:@"EmptyKey"]);
+    XCTAssertEqual(providerCallCount, 3);
+}
+
+- (void)testContactAddressContentFingerprint
+{
+    OHContactAddress *address = [[OHContactAddress alloc] initWithLabel:@"address" street:@"test" city:@"test" state:@"test" postalCode:@"test" country:@"country" dataProviderIdentifier:@"test"];
+    OHContactAddress *equalAddress = [[OHContactAddress alloc] initWithLabel:@"address" street:@"test" city:@"test" state:@"test" postalCode:@"test" country:@"country" dataProviderIdentifier:@"test"];
+    OHContactAddress *otherAddress = [[OHContactAddress alloc] initWithLabel:@"address" street:@"test" city:@"test" state:@"test" postalCode:@"test2" country:@"country" dataProviderIdentifier:@"test"];
+
+    XCTAssertEqual(address.contentFingerprint, equalAddress.contentFingerprint);
+    XCTAssertNotEqual(address.contentFingerprint, otherAddress.contentFingerprint);
+}
+
 - (void)testEquality
 {
     OHContact *testContact = [[OHContact alloc] init];
@@ -0,0 +1,123 @@
+//
+//  OHContactsDataSourceChangeTests.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <XCTest/XCTest.h>
+#import <Ohana/Ohana.h>
+
+#import "NSOrderedSetMake+Internal.h"
+
+@interface OHContactsDataSourceChangeTests : XCTestCase
+
+@property (nonatomic) OHContactsDataSourceChangeKeyBlock keyBlock;
+
+@end
+
+@implementation OHContactsDataSourceChangeTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    _keyBlock = ^id<NSCopying>(OHContact *contact) {
+        return contact.fullName;
+    };
+}
+
+- (void)testNoChanges
+{
+    NSOrderedSet *contacts = NSOrderedSetMake([self _contactWithFullName:@"A"], [self _contactWithFullName:@"B"]);
+
+    OHContactsDataSourceChange *change = [OHContactsDataSourceChange changeFromContacts:contacts toContacts:contacts keyBlock:self.keyBlock updatedKeys:[NSSet set]];
+
+    XCTAssertFalse(change.hasChanges);
+    XCTAssertEqual(change.removedIndexes.count, 0);
+    XCTAssertEqual(change.insertedIndexes.count, 0);
+    XCTAssertEqual(change.updatedIndexes.count, 0);
+    XCTAssertEqual(change.movedIndexes.count, 0);
+}
+
+- (void)testInsertionsAndRemovals
+{
+    NSOrderedSet *previousContacts = NSOrderedSetMake([self _contactWithFullName:@"A"], [self _contactWithFullName:@"B"], [self _contactWithFullName:@"C"]);
+    NSOrderedSet *contacts = NSOrderedSetMake([self _contactWithFullName:@"A"], [self _contactWithFullName:@"D"], [self _contactWithFullName:@"C"]);
+
+    OHContactsDataSourceChange *change = [OHContactsDataSourceChange changeFromContacts:previousContacts toContacts:contacts keyBlock:self.keyBlock updatedKeys:[NSSet set]];
+
+    XCTAssertTrue(change.hasChanges);
+    XCTAssert([change.removedIndexes isEqualToIndexSet:[NSIndexSet indexSetWithIndex:1]]);
+    XCTAssert([change.insertedIndexes isEqualToIndexSet:[NSIndexSet indexSetWithIndex:1]]);
+    XCTAssertEqual(change.updatedIndexes.count, 0);
+    XCTAssertEqual(change.movedIndexes.count, 0);
+}
+
+- (void)testUpdates
+{
+    NSOrderedSet *previousContacts = NSOrderedSetMake([self _contactWithFullName:@"A"], [self _contactWithFullName:@"B"]);
+    NSOrderedSet *contacts = NSOrderedSetMake([self _contactWithFullName:@"A"], [self _contactWithFullName:@"B"]);
+
+    OHContactsDataSourceChange *change = [OHContactsDataSourceChange changeFromContacts:previousContacts toContacts:contacts keyBlock:self.keyBlock updatedKeys:[NSSet setWithObject:@"B"]];
+
+    XCTAssertTrue(change.hasChanges);
+    XCTAssert([change.updatedIndexes isEqualToIndexSet:[NSIndexSet indexSetWithIndex:1]]);
+    XCTAssertEqual(change.removedIndexes.count, 0);
+    XCTAssertEqual(change.insertedIndexes.count, 0);
+}
+
+- (void)testMoves
+{
+    NSOrderedSet *previousContacts = NSOrderedSetMake([self _contactWithFullName:@"A"], [self _contactWithFullName:@"B"], [self _contactWithFullName:@"C"]);
+    NSOrderedSet *contacts = NSOrderedSetMake([self _contactWithFullName:@"B"], [self _contactWithFullName:@"C"], [self _contactWithFullName:@"A"]);
+
+    OHContactsDataSourceChange *change = [OHContactsDataSourceChange changeFromContacts:previousContacts toContacts:contacts keyBlock:self.keyBlock updatedKeys:[NSSet set]];
+
+    XCTAssertTrue(change.hasChanges);
+    XCTAssertEqual(change.movedIndexes.count, 1);
+    XCTAssertEqualObjects(change.movedIndexes[@0], @2);
+    XCTAssertEqual(change.removedIndexes.count, 0);
+    XCTAssertEqual(change.insertedIndexes.count, 0);
+}
+
+- (void)testDuplicateKeys
+{
+    NSOrderedSet *previousContacts = NSOrderedSetMake([self _contactWithFullName:@"A"], [self _contactWithFullName:@"A"]);
+    NSOrderedSet *contacts = NSOrderedSetMake([self _contactWithFullName:@"A"]);
+
+    OHContactsDataSourceChange *change = [OHContactsDataSourceChange changeFromContacts:previousContacts toContacts:contacts keyBlock:self.keyBlock updatedKeys:[NSSet set]];
+
+    XCTAssert([change.removedIndexes isEqualToIndexSet:[NSIndexSet indexSetWithIndex:1]]);
+    XCTAssertEqual(change.insertedIndexes.count, 0);
+}
+
+#pragma mark - Private Helpers
+
+- (OHContact *)_contactWithFullName:(NSString *)fullName
+{
+    OHContact *contact = [[OHContact alloc] init];
+    contact.fullName = fullName;
+    return contact;
+}
+
+@end
@@ -36,6 +36,54 @@
 
 @end
 
+/**
+ *  Data provider that cannot cancel its loads, and completes them one at a time when told to
+ */
+@interface OHUncancellableContactsDataProvider : NSObject <OHContactsDataProviderProtocol>
+
+- (void)finishLoadingWithContacts:(NSOrderedSet<OHContact *> *)contacts;
+
+@end
+
+@implementation OHUncancellableContactsDataProvider {
+    NSUInteger _pendingLoadCount;
+}
+
+@synthesize onContactsDataProviderFinishedLoadingSignal = _onContactsDataProviderFinishedLoadingSignal, onContactsDataProviderErrorSignal = _onContactsDataProviderErrorSignal, contacts = _contacts;
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _onContactsDataProviderFinishedLoadingSignal = [[OHContactsDataProviderFinishedLoadingSignal alloc] init];
+        _onContactsDataProviderErrorSignal = [[OHContactsDataProviderErrorSignal alloc] init];
+    }
+    return self;
+}
+
+- (OHContactsDataProviderStatus)status
+{
+    return _pendingLoadCount ? OHContactsDataProviderStatusProcessing : OHContactsDataProviderStatusLoaded;
+}
+
+- (void)loadContacts
+{
+    _pendingLoadCount++;
+}
+
+- (void)finishLoadingWithContacts:(NSOrderedSet<OHContact *> *)contacts
+{
+    _pendingLoadCount--;
+    _contacts = contacts;
+    self.onContactsDataProviderFinishedLoadingSignal.fire(self);
+}
+
++ (NSString *)providerIdentifier
+{
+    return NSStringFromClass([OHUncancellableContactsDataProvider class]);
+}
+
+@end
+
 @interface OHContactsDataSourceTests : XCTestCase
 
 @property (nonatomic) id dataProviderMock;
@@ -287,6 +335,400 @@
     [self waitForExpectationsWithTimeout:0.1 handler:nil];
 }
 
+- (void)testLoadContactsConcurrently
+{
+    OHContact *contactA = [[OHContact alloc] init];
+    OHContact *contactB = [[OHContact alloc] init];
+    OCMStub([self.dataProviderMock contacts]).andReturn(NSOrderedSetMake(contactA));
+
+    id secondDataProviderMock = [self _createDataProviderMock];
+    OCMStub([secondDataProviderMock contacts]).andReturn(NSOrderedSetMake(contactB));
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(self.dataProviderMock, secondDataProviderMock) postProcessors:nil];
+    dataSource.loadingMode = OHContactsDataSourceLoadingModeConcurrent;
+    dataSource.deliveryQueue = dispatch_get_main_queue();
+
+    XCTestExpectation *onReadyExpectation = [self expectationWithDescription:@"Data source ready signal should have fired"];
+    [dataSource.onContactsDataSourceReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nullable contacts) {
+        XCTAssertTrue([NSThread isMainThread]);
+        NSOrderedSet *expectedContacts = NSOrderedSetMake(contactA, contactB);
+        XCTAssert([contacts isEqualToOrderedSet:expectedContacts]);
+        XCTAssert([dataSource.contacts isEqualToOrderedSet:expectedContacts]);
+        [onReadyExpectation fulfill];
+    }];
+
+    [dataSource loadContacts];
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testLoadContactsWithBackgroundProcessing
+{
+    NSOrderedSet *contacts = NSOrderedSetMake([[OHContact alloc] init], [[OHContact alloc] init]);
+    OCMStub([self.dataProviderMock contacts]).andReturn(contacts);
+
+    id postProcessorMock = OCMStrictProtocolMock(@protocol(OHContactsPostProcessorProtocol));
+    OCMStub([postProcessorMock configurationFingerprint]).andReturn(nil);
+    OCMStub([postProcessorMock processContacts:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        XCTAssertFalse([NSThread isMainThread]);
+        __unsafe_unretained NSOrderedSet *preProcessedContacts;
+        [invocation getArgument:&preProcessedContacts atIndex:2];
+        [invocation setReturnValue:&preProcessedContacts];
+    });
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(self.dataProviderMock)
+                                                                            postProcessors:NSOrderedSetMake(postProcessorMock)];
+    dataSource.processingMode = OHContactsDataSourceProcessingModeBackground;
+    dataSource.processingQualityOfService = NSQualityOfServiceUtility;
+    dataSource.deliveryQueue = dispatch_get_main_queue();
+
+    XCTestExpectation *onReadyExpectation = [self expectationWithDescription:@"Data source ready signal should have fired"];
+    [dataSource.onContactsDataSourceReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nullable readyContacts) {
+        XCTAssertTrue([NSThread isMainThread]);
+        XCTAssert([readyContacts isEqualToOrderedSet:contacts]);
+        [onReadyExpectation fulfill];
+    }];
+
+    [dataSource loadContacts];
+
+    XCTAssertNil(dataSource.contacts);
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testLoadContactsWithPartialResults
+{
+    OHContact *contactA = [[OHContact alloc] init];
+    OHContact *contactB = [[OHContact alloc] init];
+
+    id dataProviderMock = OCMStrictProtocolMock(@protocol(OHContactsDataProviderProtocol));
+    OHContactsDataProviderFinishedLoadingSignal *onContactsDataProviderFinishedLoadingSignal = [[OHContactsDataProviderFinishedLoadingSignal alloc] init];
+    OCMStub([dataProviderMock onContactsDataProviderFinishedLoadingSignal]).andReturn(onContactsDataProviderFinishedLoadingSignal);
+    OHContactsDataProviderErrorSignal *onContactsDataProviderErrorSignal = [[OHContactsDataProviderErrorSignal alloc] init];
+    OCMStub([dataProviderMock onContactsDataProviderErrorSignal]).andReturn(onContactsDataProviderErrorSignal);
+    OHContactsDataProviderBatchLoadedSignal *onContactsDataProviderBatchLoadedSignal = [[OHContactsDataProviderBatchLoadedSignal alloc] init];
+    OCMStub([dataProviderMock onContactsDataProviderBatchLoadedSignal]).andReturn(onContactsDataProviderBatchLoadedSignal);
+    OCMStub([dataProviderMock lastLoadTransformDuration]).andReturn(0.0);
+    OCMStub([dataProviderMock cancelLoading]);
+    OCMStub([dataProviderMock contactIdentifierForContact:OCMOCK_ANY]).andReturn(nil);
+    OCMStub([dataProviderMock contacts]).andReturn(NSOrderedSetMake(contactA, contactB));
+    OCMStub([dataProviderMock loadContacts]).andDo(^(NSInvocation *invocation) {
+        onContactsDataProviderBatchLoadedSignal.fire(NSOrderedSetMake(contactA), dataProviderMock);
+    });
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(dataProviderMock) postProcessors:nil];
+    dataSource.processingMode = OHContactsDataSourceProcessingModeBackground;
+
+    XCTestExpectation *onPartialReadyExpectation = [self expectationWithDescription:@"Data source partial ready signal should have fired"];
+    [dataSource.onContactsDataSourcePartialReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nonnull contacts) {
+        NSOrderedSet *expectedContacts = NSOrderedSetMake(contactA);
+        XCTAssert([contacts isEqualToOrderedSet:expectedContacts]);
+        XCTAssertNil(dataSource.contacts);
+        [onPartialReadyExpectation fulfill];
+
+        onContactsDataProviderFinishedLoadingSignal.fire(dataProviderMock);
+    }];
+
+    XCTestExpectation *onReadyExpectation = [self expectationWithDescription:@"Data source ready signal should have fired"];
+    [dataSource.onContactsDataSourceReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nullable contacts) {
+        NSOrderedSet *expectedContacts = NSOrderedSetMake(contactA, contactB);
+        XCTAssert([contacts isEqualToOrderedSet:expectedContacts]);
+        [onReadyExpectation fulfill];
+    }];
+
+    [dataSource loadContacts];
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testLoadContactsCancelsSupersededLoad
+{
+    OHContact *contactA = [[OHContact alloc] init];
+    OHContact *contactB = [[OHContact alloc] init];
+
+    id dataProviderMock = OCMStrictProtocolMock(@protocol(OHContactsDataProviderProtocol));
+    OHContactsDataProviderFinishedLoadingSignal *onContactsDataProviderFinishedLoadingSignal = [[OHContactsDataProviderFinishedLoadingSignal alloc] init];
+    OCMStub([dataProviderMock onContactsDataProviderFinishedLoadingSignal]).andReturn(onContactsDataProviderFinishedLoadingSignal);
+    OHContactsDataProviderErrorSignal *onContactsDataProviderErrorSignal = [[OHContactsDataProviderErrorSignal alloc] init];
+    OCMStub([dataProviderMock onContactsDataProviderErrorSignal]).andReturn(onContactsDataProviderErrorSignal);
+    OHContactsDataProviderBatchLoadedSignal *onContactsDataProviderBatchLoadedSignal = [[OHContactsDataProviderBatchLoadedSignal alloc] init];
+    OCMStub([dataProviderMock onContactsDataProviderBatchLoadedSignal]).andReturn(onContactsDataProviderBatchLoadedSignal);
+    OCMStub([dataProviderMock lastLoadTransformDuration]).andReturn(0.0);
+    OCMStub([dataProviderMock contacts]).andReturn(NSOrderedSetMake(contactA, contactB));
+    OCMStub([dataProviderMock contactIdentifierForContact:OCMOCK_ANY]).andReturn(nil);
+
+    __block NSUInteger loadCount = 0;
+    __block NSUInteger cancelCount = 0;
+    OCMStub([dataProviderMock cancelLoading]).andDo(^(NSInvocation *invocation) {
+        cancelCount++;
+    });
+    OCMStub([dataProviderMock loadContacts]).andDo(^(NSInvocation *invocation) {
+        // The first load never finishes on its own, the second one finishes immediately
+        if (++loadCount > 1) {
+            onContactsDataProviderFinishedLoadingSignal.fire(dataProviderMock);
+        }
+    });
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(dataProviderMock) postProcessors:nil];
+
+    __block NSUInteger readyCount = 0;
+    [dataSource.onContactsDataSourceReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nullable contacts) {
+        readyCount++;
+        NSOrderedSet *expectedContacts = NSOrderedSetMake(contactA, contactB);
+        XCTAssert([contacts isEqualToOrderedSet:expectedContacts]);
+    }];
+
+    [dataSource loadContacts];
+    XCTAssertEqual(readyCount, 0);
+
+    [dataSource loadContacts];
+    XCTAssertEqual(cancelCount, 1);
+    XCTAssertEqual(readyCount, 1);
+
+    // A late result from the superseded load is ignored
+    onContactsDataProviderFinishedLoadingSignal.fire(dataProviderMock);
+    XCTAssertEqual(readyCount, 1);
+}
+
+- (void)testLoadContactsIgnoresResultOfSupersededLoad
+{
+    NSOrderedSet<OHContact *> *staleContacts = NSOrderedSetMake([[OHContact alloc] init]);
+    NSOrderedSet<OHContact *> *currentContacts = NSOrderedSetMake([[OHContact alloc] init], [[OHContact alloc] init]);
+    OHUncancellableContactsDataProvider *dataProvider = [[OHUncancellableContactsDataProvider alloc] init];
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(dataProvider) postProcessors:nil];
+
+    __block NSUInteger readyCount = 0;
+    [dataSource.onContactsDataSourceReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nullable contacts) {
+        readyCount++;
+        XCTAssert([contacts isEqualToOrderedSet:currentContacts]);
+    }];
+
+    [dataSource loadContacts];
+    [dataSource loadContacts];
+
+    // The data provider could not cancel the first load, whose result arrives first and does not count towards the second one
+    [dataProvider finishLoadingWithContacts:staleContacts];
+    XCTAssertEqual(readyCount, 0);
+
+    [dataProvider finishLoadingWithContacts:currentContacts];
+    XCTAssertEqual(readyCount, 1);
+}
+
+- (void)testLoadContactsWithReadinessDeadline
+{
+    OHContact *contactA = [[OHContact alloc] init];
+    OHContact *contactB = [[OHContact alloc] init];
+    OCMStub([self.dataProviderMock contacts]).andReturn(NSOrderedSetMake(contactA));
+
+    id slowDataProviderMock = [self _createDataProviderMockFinishingLoad:NO];
+    OCMStub([slowDataProviderMock contacts]).andReturn(NSOrderedSetMake(contactB));
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(self.dataProviderMock, slowDataProviderMock) postProcessors:nil];
+    dataSource.readinessDeadline = 0.05;
+    dataSource.deliveryQueue = dispatch_get_main_queue();
+
+    XCTestExpectation *onReadyExpectation = [self expectationWithDescription:@"Data source ready signal should have fired at the deadline"];
+    [dataSource.onContactsDataSourceReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nullable contacts) {
+        NSOrderedSet *expectedContacts = NSOrderedSetMake(contactA);
+        XCTAssert([contacts isEqualToOrderedSet:expectedContacts]);
+        XCTAssertTrue(dataSource.isPartial);
+        [onReadyExpectation fulfill];
+    }];
+
+    [dataSource loadContacts];
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    XCTestExpectation *onChangedExpectation = [self expectationWithDescription:@"Data source changed signal should have fired with the late contacts"];
+    [dataSource.onContactsDataSourceChangedSignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nonnull contacts, OHContactsDataSourceChange * _Nonnull change) {
+        NSOrderedSet *expectedContacts = NSOrderedSetMake(contactA, contactB);
+        XCTAssert([contacts isEqualToOrderedSet:expectedContacts]);
+        XCTAssertEqualObjects(change.insertedIndexes, [NSIndexSet indexSetWithIndex:1]);
+        XCTAssertFalse(dataSource.isPartial);
+        [onChangedExpectation fulfill];
+    }];
+
+    [slowDataProviderMock onContactsDataProviderFinishedLoadingSignal].fire(slowDataProviderMock);
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
+- (void)testLoadContactsSkipsFailedDataProvider
+{
+    OHContact *contactA = [[OHContact alloc] init];
+    OCMStub([self.dataProviderMock contacts]).andReturn(NSOrderedSetMake(contactA));
+
+    id failingDataProviderMock = [self _createDataProviderMockFinishingLoad:NO];
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(self.dataProviderMock, failingDataProviderMock) postProcessors:nil];
+    dataSource.failurePolicy = OHContactsDataSourceFailurePolicySkip;
+
+    XCTestExpectation *onReadyExpectation = [self expectationWithDescription:@"Data source ready signal should have fired"];
+    [dataSource.onContactsDataSourceReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nullable contacts) {
+        NSOrderedSet *expectedContacts = NSOrderedSetMake(contactA);
+        XCTAssert([contacts isEqualToOrderedSet:expectedContacts]);
+        XCTAssertTrue(dataSource.isPartial);
+        [onReadyExpectation fulfill];
+    }];
+
+    [dataSource loadContacts];
+
+    NSError *error = [NSError errorWithDomain:@"OHContactsDataSourceTests" code:1 userInfo:nil];
+    [failingDataProviderMock onContactsDataProviderErrorSignal].fire(error, failingDataProviderMock);
+
+    [self waitForExpectationsWithTimeout:0.1 handler:nil];
+}
+
+- (void)testUpdatePostProcessorsReusesUnchangedStages
+{
+    OHContact *contactA = [[OHContact alloc] init];
+    contactA.fullName = @"Alice";
+    OHContact *contactB = [[OHContact alloc] init];
+    contactB.fullName = @"Bob";
+    OCMStub([self.dataProviderMock contacts]).andReturn(NSOrderedSetMake(contactB, contactA));
+
+    __block NSUInteger firstStageRunCount = 0;
+    id firstStageMock = OCMStrictProtocolMock(@protocol(OHContactsPostProcessorProtocol));
+    OCMStub([firstStageMock configurationFingerprint]).andReturn(@"first");
+    OCMStub([firstStageMock processContacts:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        firstStageRunCount++;
+        __unsafe_unretained NSOrderedSet *preProcessedContacts;
+        [invocation getArgument:&preProcessedContacts atIndex:2];
+        [invocation setReturnValue:&preProcessedContacts];
+    });
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(self.dataProviderMock)
+                                                                            postProcessors:NSOrderedSetMake(firstStageMock, [[OHReverseOrderPostProcessor alloc] init])];
+    [dataSource loadContacts];
+
+    XCTAssertEqual(firstStageRunCount, 1);
+    XCTAssert([dataSource.contacts isEqualToOrderedSet:NSOrderedSetMake(contactA, contactB)]);
+
+    [dataSource updatePostProcessors:NSOrderedSetMake(firstStageMock, self.alphabeticalSortPostProcessor)];
+
+    XCTAssertEqual(firstStageRunCount, 1);
+    XCTAssert([dataSource.contacts isEqualToOrderedSet:NSOrderedSetMake(contactA, contactB)]);
+
+    [dataSource updatePostProcessors:NSOrderedSetMake(self.alphabeticalSortPostProcessor, firstStageMock, [[OHReverseOrderPostProcessor alloc] init])];
+
+    XCTAssertEqual(firstStageRunCount, 2);
+    XCTAssert([dataSource.contacts isEqualToOrderedSet:NSOrderedSetMake(contactB, contactA)]);
+}
+
+- (void)testLoadContactsCollectsMetrics
+{
+    NSOrderedSet *contacts = NSOrderedSetMake([[OHContact alloc] init], [[OHContact alloc] init]);
+    OCMStub([self.dataProviderMock contacts]).andReturn(contacts);
+
+    OHReverseOrderPostProcessor *postProcessor = [[OHReverseOrderPostProcessor alloc] init];
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(self.dataProviderMock)
+                                                                            postProcessors:NSOrderedSetMake(postProcessor)];
+    id tracerMock = OCMProtocolMock(@protocol(OHContactsDataSourceTracingProtocol));
+    dataSource.tracer = tracerMock;
+
+    __block OHContactsDataSourceMetrics *collectedMetrics;
+    [dataSource.onContactsDataSourceMetricsSignal addObserver:self callback:^(id  _Nonnull self, OHContactsDataSourceMetrics * _Nonnull metrics) {
+        collectedMetrics = metrics;
+    }];
+
+    [dataSource loadContacts];
+
+    XCTAssertEqual(collectedMetrics.dataProviderMetrics.count, 1);
+    XCTAssertEqual(collectedMetrics.dataProviderMetrics.firstObject.dataProvider, self.dataProviderMock);
+    XCTAssertEqual(collectedMetrics.dataProviderMetrics.firstObject.contactCount, 2);
+    XCTAssertEqual(collectedMetrics.postProcessorMetrics.count, 1);
+    XCTAssertEqual(collectedMetrics.postProcessorMetrics.firstObject.postProcessor, postProcessor);
+    XCTAssertEqual(collectedMetrics.postProcessorMetrics.firstObject.inputCount, 2);
+    XCTAssertEqual(collectedMetrics.postProcessorMetrics.firstObject.outputCount, 2);
+    XCTAssertFalse(collectedMetrics.postProcessorMetrics.firstObject.isReused);
+    XCTAssertGreaterThanOrEqual(collectedMetrics.readyDuration, collectedMetrics.combineDuration);
+
+    OCMVerify([tracerMock contactsDataSource:dataSource didBeginStage:@"load"]);
+    OCMVerify([tracerMock contactsDataSource:dataSource didBeginStage:@"combine"]);
+    OCMVerify([tracerMock contactsDataSource:dataSource didBeginStage:@"postProcessor.OHReverseOrderPostProcessor"]);
+    OCMVerify([tracerMock contactsDataSource:dataSource didEndStage:@"load" duration:collectedMetrics.readyDuration]);
+    OCMVerify([tracerMock contactsDataSource:dataSource didCollectMetrics:collectedMetrics]);
+
+    [dataSource reprocessContacts];
+
+    XCTAssertEqual(collectedMetrics.dataProviderMetrics.count, 0);
+    XCTAssertTrue(collectedMetrics.postProcessorMetrics.firstObject.isReused);
+    OCMVerify([tracerMock contactsDataSource:dataSource didBeginStage:@"reprocess"]);
+}
+
+- (void)testLoadContactsFromSnapshot
+{
+    NSURL *fileURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    OHContactsSnapshotStore *snapshotStore = [[OHContactsSnapshotStore alloc] initWithFileURL:fileURL contentVersion:1];
+    OHContact *snapshotContact = [[OHContact alloc] init];
+    snapshotContact.fullName = @"Snapshot";
+    XCTAssertTrue([snapshotStore writeContacts:NSOrderedSetMake(snapshotContact) error:nil]);
+
+    NSOrderedSet *contacts = NSOrderedSetMake([[OHContact alloc] init], [[OHContact alloc] init]);
+    OCMStub([self.dataProviderMock contacts]).andReturn(contacts);
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(self.dataProviderMock) postProcessors:nil];
+    dataSource.snapshotStore = snapshotStore;
+
+    XCTestExpectation *onSnapshotLoadedExpectation = [self expectationWithDescription:@"Data source snapshot loaded signal should have fired"];
+    [dataSource.onContactsDataSourceSnapshotLoadedSignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nonnull snapshotContacts) {
+        XCTAssertEqual(snapshotContacts.count, 1);
+        XCTAssertTrue([snapshotContacts.firstObject isEqualToContact:snapshotContact]);
+        XCTAssert([dataSource.contacts isEqualToOrderedSet:snapshotContacts]);
+        [onSnapshotLoadedExpectation fulfill];
+    }];
+
+    XCTestExpectation *onReadyExpectation = [self expectationWithDescription:@"Data source ready signal should have fired"];
+    [dataSource.onContactsDataSourceReadySignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nullable readyContacts) {
+        XCTAssert([dataSource.contacts isEqualToOrderedSet:contacts]);
+        [onReadyExpectation fulfill];
+    }];
+
+    [dataSource loadContacts];
+
+    [self waitForExpectationsWithTimeout:0.1 handler:nil];
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+- (void)testRefreshOnChange
+{
+    OHContact *contactA = [self _createContactWithIdentifier:@"a" fullName:@"Alice"];
+    OHContact *contactB = [self _createContactWithIdentifier:@"b" fullName:@"Bob"];
+    OHContact *updatedContactB = [self _createContactWithIdentifier:@"b" fullName:@"Robert"];
+    OHContact *contactC = [self _createContactWithIdentifier:@"c" fullName:@"Carol"];
+
+    OCMStub([self.dataProviderMock contacts]).andReturn(NSOrderedSetMake(contactA, contactB));
+    OCMStub([self.dataProviderMock fetchContactsWithIdentifiers:nil error:[OCMArg anyObjectRef]]).andReturn(NSOrderedSetMake(updatedContactB, contactC));
+
+    id changeSourceMock = OCMStrictProtocolMock(@protocol(OHContactsChangeSourceProtocol));
+    OHContactsChangeSourceChangedSignal *onContactsChangeSourceChangedSignal = [[OHContactsChangeSourceChangedSignal alloc] init];
+    OCMStub([changeSourceMock onContactsChangeSourceChangedSignal]).andReturn(onContactsChangeSourceChangedSignal);
+
+    OHContactsDataSource *dataSource = [[OHContactsDataSource alloc] initWithDataProviders:NSOrderedSetMake(self.dataProviderMock) postProcessors:nil];
+    dataSource.changeSource = changeSourceMock;
+    dataSource.changeCoalescingInterval = 0.05;
+    dataSource.deliveryQueue = dispatch_get_main_queue();
+
+    XCTestExpectation *onChangedExpectation = [self expectationWithDescription:@"Data source changed signal should have fired once"];
+    [dataSource.onContactsDataSourceChangedSignal addObserver:self callback:^(id  _Nonnull self, NSOrderedSet<OHContact *> * _Nonnull contacts, OHContactsDataSourceChange * _Nonnull change) {
+        NSOrderedSet *expectedContacts = NSOrderedSetMake(updatedContactB, contactC);
+        XCTAssert([contacts isEqualToOrderedSet:expectedContacts]);
+        XCTAssert([dataSource.contacts isEqualToOrderedSet:expectedContacts]);
+        XCTAssert([change.removedIndexes isEqualToIndexSet:[NSIndexSet indexSetWithIndex:0]]);
+        XCTAssert([change.updatedIndexes isEqualToIndexSet:[NSIndexSet indexSetWithIndex:1]]);
+        XCTAssert([change.insertedIndexes isEqualToIndexSet:[NSIndexSet indexSetWithIndex:1]]);
+        XCTAssertEqual(change.movedIndexes.count, 0);
+        [onChangedExpectation fulfill];
+    }];
+
+    [dataSource loadContacts];
+
+    onContactsChangeSourceChangedSignal.fire(nil, changeSourceMock);
+    onContactsChangeSourceChangedSignal.fire(nil, changeSourceMock);
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+}
+
 - (void)testContactFiltering
 {
     OHContact *contactA = [[OHContact alloc] init];
@@ -316,6 +758,11 @@
 #pragma mark - Private Helpers
 
 - (id)_createDataProviderMock
+{
+    return [self _createDataProviderMockFinishingLoad:YES];
+}
+
+- (id)_createDataProviderMockFinishingLoad:(BOOL)finishingLoad
 {
     id dataProviderMock = OCMStrictProtocolMock(@protocol(OHContactsDataProviderProtocol));
     OCMStub([dataProviderMock status]).andReturn(OHContactsDataProviderStatusInitialized);
@@ -323,15 +770,37 @@
     OCMStub([dataProviderMock onContactsDataProviderFinishedLoadingSignal]).andReturn(onContactsDataProviderFinishedLoadingSignal);
     OHContactsDataProviderErrorSignal *onContactsDataProviderErrorSignal = [[OHContactsDataProviderErrorSignal alloc] init];
     OCMStub([dataProviderMock onContactsDataProviderErrorSignal]).andReturn(onContactsDataProviderErrorSignal);
+    OHContactsDataProviderBatchLoadedSignal *onContactsDataProviderBatchLoadedSignal = [[OHContactsDataProviderBatchLoadedSignal alloc] init];
+    OCMStub([dataProviderMock onContactsDataProviderBatchLoadedSignal]).andReturn(onContactsDataProviderBatchLoadedSignal);
+    OCMStub([dataProviderMock lastLoadTransformDuration]).andReturn(0.0);
+    OCMStub([dataProviderMock cancelLoading]);
+    // The first matching stub wins, so this one serves every test: only contacts made by _createContactWithIdentifier:fullName: have an identifier
+    OCMStub([dataProviderMock contactIdentifierForContact:OCMOCK_ANY]).andDo(^(NSInvocation *invocation) {
+        __unsafe_unretained OHContact *contact;
+        [invocation getArgument:&contact atIndex:2];
+        __unsafe_unretained NSString *contactIdentifier = contact.customProperties[@"identifier"];
+        [invocation setReturnValue:&contactIdentifier];
+    });
     OCMStub([dataProviderMock loadContacts]).andDo(^(NSInvocation *invocation) {
-        [dataProviderMock onContactsDataProviderFinishedLoadingSignal].fire(dataProviderMock);
+        if (finishingLoad) {
+            [dataProviderMock onContactsDataProviderFinishedLoadingSignal].fire(dataProviderMock);
+        }
     });
     return dataProviderMock;
 }
 
+- (OHContact *)_createContactWithIdentifier:(NSString *)identifier fullName:(NSString *)fullName
+{
+    OHContact *contact = [[OHContact alloc] init];
+    contact.fullName = fullName;
+    contact.customProperties[@"identifier"] = identifier;
+    return contact;
+}
+
 - (id)_createPostProcessorMockWithContacts:(NSOrderedSet<OHContact *> *)contacts
 {
     id postProcessorMock = OCMStrictProtocolMock(@protocol(OHContactsPostProcessorProtocol));
+    OCMStub([postProcessorMock configurationFingerprint]).andReturn(nil);
 
     OCMStub([postProcessorMock processContacts:OCMOCK_ANY]).andReturn(contacts);
     return postProcessorMock;
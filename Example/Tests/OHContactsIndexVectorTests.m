@@ -0,0 +1,157 @@
+//
+//  OHContactsIndexVectorTests.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <XCTest/XCTest.h>
+#import <Ohana/Ohana.h>
+
+#import "NSOrderedSetMake+Internal.h"
+
+@interface OHContactsIndexVectorTests : XCTestCase
+
+@property (nonatomic) NSOrderedSet<OHContact *> *contacts;
+
+@end
+
+@implementation OHContactsIndexVectorTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    _contacts = NSOrderedSetMake([self _contactWithFullName:@"A"], [self _contactWithFullName:@"B"], [self _contactWithFullName:@"C"], [self _contactWithFullName:@"D"]);
+}
+
+- (void)testInitWithContacts
+{
+    OHContactsIndexVector *indexVector = [[OHContactsIndexVector alloc] initWithContacts:self.contacts];
+
+    XCTAssertEqual(indexVector.count, 4);
+    XCTAssertEqual([indexVector contactAtIndex:2], self.contacts[2]);
+    XCTAssertEqual([indexVector contacts], self.contacts);
+}
+
+- (void)testInitWithMutableContacts
+{
+    NSMutableOrderedSet<OHContact *> *mutableContacts = [self.contacts mutableCopy];
+    OHContactsIndexVector *indexVector = [[OHContactsIndexVector alloc] initWithContacts:mutableContacts];
+    [mutableContacts removeObjectAtIndex:0];
+
+    XCTAssertEqual(indexVector.count, 4);
+    XCTAssertEqual([indexVector contactAtIndex:0], self.contacts[0]);
+    XCTAssertEqualObjects([indexVector contacts], self.contacts);
+}
+
+- (void)testIndexVectorPassingTest
+{
+    OHContactsIndexVector *indexVector = [[OHContactsIndexVector alloc] initWithContacts:self.contacts];
+    OHContactsIndexVector *filteredIndexVector = [indexVector indexVectorPassingTest:^BOOL(OHContact *contact) {
+        return ![contact.fullName isEqualToString:@"B"];
+    }];
+
+    XCTAssertEqual(filteredIndexVector.count, 3);
+    XCTAssertEqual(filteredIndexVector.baseContacts, indexVector.baseContacts);
+    XCTAssertEqual(filteredIndexVector.positions[1], 2);
+    NSOrderedSet *expectedContacts = NSOrderedSetMake(self.contacts[0], self.contacts[2], self.contacts[3]);
+    XCTAssert([[filteredIndexVector contacts] isEqualToOrderedSet:expectedContacts]);
+}
+
+- (void)testIndexVectorPassingTestReturnsSelfWhenAllPass
+{
+    OHContactsIndexVector *indexVector = [[OHContactsIndexVector alloc] initWithContacts:self.contacts];
+    OHContactsIndexVector *filteredIndexVector = [indexVector indexVectorPassingTest:^BOOL(OHContact *contact) {
+        return YES;
+    }];
+
+    XCTAssertEqual(filteredIndexVector, indexVector);
+}
+
+- (void)testReversedIndexVector
+{
+    OHContactsIndexVector *indexVector = [[[OHContactsIndexVector alloc] initWithContacts:self.contacts] indexVectorPassingTest:^BOOL(OHContact *contact) {
+        return ![contact.fullName isEqualToString:@"A"];
+    }];
+
+    NSOrderedSet *expectedContacts = NSOrderedSetMake(self.contacts[3], self.contacts[2], self.contacts[1]);
+    XCTAssert([[[indexVector reversedIndexVector] contacts] isEqualToOrderedSet:expectedContacts]);
+}
+
+- (void)testIndexVectorWithPositions
+{
+    OHContactsIndexVector *indexVector = [[OHContactsIndexVector alloc] initWithContacts:self.contacts];
+    uint32_t positions[] = {3, 0};
+    OHContactsIndexVector *selectedIndexVector = [indexVector indexVectorWithPositions:[NSData dataWithBytes:positions length:sizeof(positions)]];
+
+    NSOrderedSet *expectedContacts = NSOrderedSetMake(self.contacts[3], self.contacts[0]);
+    XCTAssert([[selectedIndexVector contacts] isEqualToOrderedSet:expectedContacts]);
+}
+
+- (void)testEmptyIndexVector
+{
+    OHContactsIndexVector *indexVector = [[[OHContactsIndexVector alloc] initWithContacts:self.contacts] indexVectorPassingTest:^BOOL(OHContact *contact) {
+        return NO;
+    }];
+
+    XCTAssertEqual(indexVector.count, 0);
+    XCTAssertEqual([indexVector contacts].count, 0);
+}
+
+- (void)testSetAlgebra
+{
+    OHContactsIndexVector *indexVector = [[OHContactsIndexVector alloc] initWithContacts:self.contacts];
+    OHContactsIndexVector *firstIndexVector = [indexVector indexVectorOfContacts:NSOrderedSetMake(self.contacts[2], self.contacts[0], self.contacts[1])];
+    OHContactsIndexVector *secondIndexVector = [indexVector indexVectorOfContacts:NSOrderedSetMake(self.contacts[1], self.contacts[3])];
+
+    NSOrderedSet *expectedIntersection = NSOrderedSetMake(self.contacts[1]);
+    XCTAssert([[[firstIndexVector indexVectorIntersectingIndexVector:secondIndexVector] contacts] isEqualToOrderedSet:expectedIntersection]);
+
+    NSOrderedSet *expectedUnion = NSOrderedSetMake(self.contacts[2], self.contacts[0], self.contacts[1], self.contacts[3]);
+    XCTAssert([[[firstIndexVector indexVectorUnioningIndexVectors:@[secondIndexVector]] contacts] isEqualToOrderedSet:expectedUnion]);
+
+    NSOrderedSet *expectedSymmetricDifference = NSOrderedSetMake(self.contacts[2], self.contacts[0], self.contacts[3]);
+    XCTAssert([[[firstIndexVector indexVectorSymmetricDifferenceWithIndexVector:secondIndexVector] contacts] isEqualToOrderedSet:expectedSymmetricDifference]);
+}
+
+- (void)testIndexVectorOfContactsDropsUnknownContacts
+{
+    OHContactsIndexVector *indexVector = [[[OHContactsIndexVector alloc] initWithContacts:self.contacts] indexVectorPassingTest:^BOOL(OHContact *contact) {
+        return ![contact.fullName isEqualToString:@"A"];
+    }];
+    OHContactsIndexVector *contactsIndexVector = [indexVector indexVectorOfContacts:NSOrderedSetMake(self.contacts[0], self.contacts[3], [self _contactWithFullName:@"E"])];
+
+    NSOrderedSet *expectedContacts = NSOrderedSetMake(self.contacts[3]);
+    XCTAssert([[contactsIndexVector contacts] isEqualToOrderedSet:expectedContacts]);
+}
+
+#pragma mark - Private Helpers
+
+- (OHContact *)_contactWithFullName:(NSString *)fullName
+{
+    OHContact *contact = [[OHContact alloc] init];
+    contact.fullName = fullName;
+    return contact;
+}
+
+@end
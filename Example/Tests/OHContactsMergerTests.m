@@ -0,0 +1,145 @@
+//
+//  OHContactsMergerTests.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <XCTest/XCTest.h>
+#import <Ohana/Ohana.h>
+#import <OCMock/OCMock.h>
+
+#import "NSOrderedSetMake+Internal.h"
+
+@interface OHContactsMergerTests : XCTestCase
+
+@property (nonatomic) id deviceDataProviderMock;
+@property (nonatomic) id serverDataProviderMock;
+
+@end
+
+@implementation OHContactsMergerTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    _deviceDataProviderMock = OCMProtocolMock(@protocol(OHContactsDataProviderProtocol));
+    _serverDataProviderMock = OCMProtocolMock(@protocol(OHContactsDataProviderProtocol));
+}
+
+- (void)testMergeOnPhoneNumber
+{
+    OHContact *deviceContact = [self _contactWithFullName:@"Alice" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"mobile" value:@"(415) 555-1234" dataProviderIdentifier:@"device"])];
+    OHContact *serverContact = [self _contactWithFullName:@"Alice Server" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"mobile" value:@"+1 415 555 1234" dataProviderIdentifier:@"server"],
+                                                                                                          [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"work" value:@"alice@example.com" dataProviderIdentifier:@"server"])];
+    serverContact.organizationName = @"Example";
+    OHContact *otherContact = [self _contactWithFullName:@"Bob" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"mobile" value:@"415 555 9876" dataProviderIdentifier:@"server"])];
+
+    OHContactsMerger *merger = [[OHContactsMerger alloc] initWithDataProviderPrecedence:NSOrderedSetMake(self.deviceDataProviderMock)];
+    NSOrderedSet<OHContact *> *mergedContacts = [merger mergeContactsByDataProvider:[self _contactsByDataProviderWithDeviceContacts:NSOrderedSetMake(deviceContact) serverContacts:NSOrderedSetMake(serverContact, otherContact)]
+                                                                      dataProviders:NSOrderedSetMake(self.serverDataProviderMock, self.deviceDataProviderMock)];
+
+    XCTAssertEqual(mergedContacts.count, 2);
+
+    OHContact *mergedContact = mergedContacts.firstObject;
+    XCTAssertEqualObjects(mergedContact.fullName, @"Alice");
+    XCTAssertEqualObjects(mergedContact.organizationName, @"Example");
+    XCTAssertEqual(mergedContact.contactFields.count, 2);
+    XCTAssertEqualObjects(mergedContact.contactFields.firstObject.value, @"(415) 555-1234");
+    NSArray *expectedSourceContacts = @[deviceContact, serverContact];
+    XCTAssertEqualObjects([mergedContact.customProperties objectForKey:kOHContactsMergerSourceContactsKey], expectedSourceContacts);
+
+    XCTAssertEqual(mergedContacts.lastObject, otherContact);
+}
+
+- (void)testMergeDoesNotChainThroughSameDataProvider
+{
+    OHContact *deviceContact = [self _contactWithFullName:@"Alice" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"home" value:@"Alice@Example.com " dataProviderIdentifier:@"device"])];
+    OHContact *firstServerContact = [self _contactWithFullName:nil contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"home" value:@"alice@example.com" dataProviderIdentifier:@"server"],
+                                                                                                    [[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"mobile" value:@"4155551234" dataProviderIdentifier:@"server"])];
+    OHContact *secondServerContact = [self _contactWithFullName:nil contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"mobile" value:@"415-555-1234" dataProviderIdentifier:@"server"])];
+
+    OHContactsMerger *merger = [[OHContactsMerger alloc] initWithDataProviderPrecedence:nil];
+    NSOrderedSet<OHContact *> *mergedContacts = [merger mergeContactsByDataProvider:[self _contactsByDataProviderWithDeviceContacts:NSOrderedSetMake(deviceContact) serverContacts:NSOrderedSetMake(firstServerContact, secondServerContact)]
+                                                                      dataProviders:NSOrderedSetMake(self.deviceDataProviderMock, self.serverDataProviderMock)];
+
+    // The second server contact shares a phone number with the first one, but both come from the same data provider
+    XCTAssertEqual(mergedContacts.count, 2);
+    XCTAssertEqualObjects(mergedContacts.firstObject.fullName, @"Alice");
+    XCTAssertEqual(mergedContacts.firstObject.contactFields.count, 2);
+    NSArray *expectedSourceContacts = @[deviceContact, firstServerContact];
+    XCTAssertEqualObjects([mergedContacts.firstObject.customProperties objectForKey:kOHContactsMergerSourceContactsKey], expectedSourceContacts);
+    XCTAssertEqual(mergedContacts.lastObject, secondServerContact);
+}
+
+- (void)testContactsOfSameDataProviderDoNotMerge
+{
+    OHContact *firstDeviceContact = [self _contactWithFullName:@"Alice" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"home" value:@"(415) 555-1234" dataProviderIdentifier:@"device"],
+                                                                                                       [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"home" value:@"family@example.com" dataProviderIdentifier:@"device"])];
+    OHContact *secondDeviceContact = [self _contactWithFullName:@"Bob" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"home" value:@"415 555 1234" dataProviderIdentifier:@"device"],
+                                                                                                      [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"home" value:@"family@example.com" dataProviderIdentifier:@"device"])];
+    OHContact *serverContact = [self _contactWithFullName:@"Bob Server" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"home" value:@"+1 415 555 1234" dataProviderIdentifier:@"server"])];
+
+    OHContactsMerger *merger = [[OHContactsMerger alloc] initWithDataProviderPrecedence:nil];
+    NSOrderedSet<OHContact *> *mergedContacts = [merger mergeContactsByDataProvider:[self _contactsByDataProviderWithDeviceContacts:NSOrderedSetMake(firstDeviceContact, secondDeviceContact) serverContacts:NSOrderedSetMake(serverContact)]
+                                                                      dataProviders:NSOrderedSetMake(self.deviceDataProviderMock, self.serverDataProviderMock)];
+
+    // The server contact merges with one device contact only, the device contacts stay separate
+    XCTAssertEqual(mergedContacts.count, 2);
+    NSArray *expectedSourceContacts = @[firstDeviceContact, serverContact];
+    XCTAssertEqualObjects([mergedContacts.firstObject.customProperties objectForKey:kOHContactsMergerSourceContactsKey], expectedSourceContacts);
+    XCTAssertEqual(mergedContacts.lastObject, secondDeviceContact);
+}
+
+- (void)testShortPhoneNumbersDoNotMerge
+{
+    OHContact *deviceContact = [self _contactWithFullName:@"Voicemail" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"other" value:@"*86" dataProviderIdentifier:@"device"])];
+    OHContact *serverContact = [self _contactWithFullName:@"Voicemail" contactFields:NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"other" value:@"*86" dataProviderIdentifier:@"server"])];
+
+    OHContactsMerger *merger = [[OHContactsMerger alloc] initWithDataProviderPrecedence:nil];
+    NSOrderedSet<OHContact *> *mergedContacts = [merger mergeContactsByDataProvider:[self _contactsByDataProviderWithDeviceContacts:NSOrderedSetMake(deviceContact) serverContacts:NSOrderedSetMake(serverContact)]
+                                                                      dataProviders:NSOrderedSetMake(self.deviceDataProviderMock, self.serverDataProviderMock)];
+
+    NSOrderedSet *expectedContacts = NSOrderedSetMake(deviceContact, serverContact);
+    XCTAssert([mergedContacts isEqualToOrderedSet:expectedContacts]);
+}
+
+#pragma mark - Private Helpers
+
+- (OHContact *)_contactWithFullName:(NSString *)fullName contactFields:(NSOrderedSet<OHContactField *> *)contactFields
+{
+    OHContact *contact = [[OHContact alloc] init];
+    contact.fullName = fullName;
+    contact.contactFields = contactFields;
+    return contact;
+}
+
+- (NSMapTable *)_contactsByDataProviderWithDeviceContacts:(NSOrderedSet<OHContact *> *)deviceContacts serverContacts:(NSOrderedSet<OHContact *> *)serverContacts
+{
+    NSMapTable *contactsByDataProvider = [NSMapTable strongToStrongObjectsMapTable];
+    [contactsByDataProvider setObject:deviceContacts forKey:self.deviceDataProviderMock];
+    [contactsByDataProvider setObject:serverContacts forKey:self.serverDataProviderMock];
+    return contactsByDataProvider;
+}
+
+@end
@@ -0,0 +1,138 @@
+//
+//  OHContactsSnapshotStoreTests.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <XCTest/XCTest.h>
+#import <Ohana/Ohana.h>
+
+#import "NSOrderedSetMake+Internal.h"
+
+@interface OHContactsSnapshotStoreTests : XCTestCase
+
+@property (nonatomic) NSURL *fileURL;
+@property (nonatomic) OHContact *contact;
+
+@end
+
+@implementation OHContactsSnapshotStoreTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    self.fileURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+
+    self.contact = [[OHContact alloc] init];
+    self.contact.fullName = @"Full Name";
+    self.contact.firstName = @"First";
+    self.contact.lastName = @"Last";
+    self.contact.organizationName = @"Organization";
+    self.contact.contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"phone" value:@"555" dataProviderIdentifier:@"test"],
+                                                  [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"email" value:@"a@b.c" dataProviderIdentifier:@"test"]);
+    self.contact.postalAddresses = NSOrderedSetMake([[OHContactAddress alloc] initWithLabel:@"address" street:@"test" city:@"test" state:@"test" postalCode:@"test" country:@"country" dataProviderIdentifier:@"test"]);
+    [self.contact.tags addObject:@"TestTag"];
+    [self.contact.customProperties setObject:@"TestProperty" forKey:@"TestPropertyKey"];
+    [self.contact.customProperties setObject:@42 forKey:@"TestIntegerKey"];
+    [self.contact.customProperties setObject:@YES forKey:@"TestBoolKey"];
+    [self.contact.contactFields.firstObject.customProperties setObject:@"+1555" forKey:@"TestFormattedKey"];
+}
+
+- (void)tearDown
+{
+    [[NSFileManager defaultManager] removeItemAtURL:self.fileURL error:nil];
+
+    [super tearDown];
+}
+
+- (void)testRoundTrip
+{
+    OHContactsSnapshotStore *snapshotStore = [[OHContactsSnapshotStore alloc] initWithFileURL:self.fileURL contentVersion:1];
+    OHContact *emptyContact = [[OHContact alloc] init];
+
+    NSError *error;
+    XCTAssertTrue([snapshotStore writeContacts:NSOrderedSetMake(self.contact, emptyContact) error:&error]);
+    XCTAssertNil(error);
+
+    NSOrderedSet<OHContact *> *contacts = [snapshotStore readContactsWithError:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual(contacts.count, 2);
+    XCTAssertTrue([contacts.firstObject isEqualToContact:self.contact]);
+    XCTAssertTrue([contacts.lastObject isEqualToContact:emptyContact]);
+}
+
+- (void)testWriteInBackground
+{
+    OHContactsSnapshotStore *snapshotStore = [[OHContactsSnapshotStore alloc] initWithFileURL:self.fileURL contentVersion:1];
+
+    XCTestExpectation *writeExpectation = [self expectationWithDescription:@"Snapshot should have been written"];
+    [snapshotStore writeContacts:NSOrderedSetMake(self.contact) completion:^(NSError * _Nullable error) {
+        XCTAssertNil(error);
+        [writeExpectation fulfill];
+    }];
+
+    // The fields are shared with the caller, whose post processors may write into them while the snapshot is encoded
+    [self.contact.contactFields.firstObject.customProperties setObject:@"+1 555" forKey:@"TestFormattedKey"];
+    [self.contact.contactFields.firstObject.tags addObject:@"LateTag"];
+
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+
+    NSOrderedSet<OHContact *> *contacts = [snapshotStore readContactsWithError:nil];
+    OHContactField *contactField = contacts.firstObject.contactFields.firstObject;
+    XCTAssertEqualObjects([contactField.customProperties objectForKey:@"TestFormattedKey"], @"+1555");
+    XCTAssertFalse([contactField.tags containsObject:@"LateTag"]);
+}
+
+- (void)testContentVersionMismatch
+{
+    OHContactsSnapshotStore *snapshotStore = [[OHContactsSnapshotStore alloc] initWithFileURL:self.fileURL contentVersion:1];
+    XCTAssertTrue([snapshotStore writeContacts:NSOrderedSetMake(self.contact) error:nil]);
+
+    OHContactsSnapshotStore *newerSnapshotStore = [[OHContactsSnapshotStore alloc] initWithFileURL:self.fileURL contentVersion:2];
+    NSError *error;
+    XCTAssertNil([newerSnapshotStore readContactsWithError:&error]);
+    XCTAssertEqualObjects(error.domain, OHContactsSnapshotStoreErrorDomain);
+    XCTAssertEqual(error.code, OHContactsSnapshotStoreErrorCodeVersionMismatch);
+}
+
+- (void)testTruncatedSnapshot
+{
+    OHContactsSnapshotStore *snapshotStore = [[OHContactsSnapshotStore alloc] initWithFileURL:self.fileURL contentVersion:1];
+    XCTAssertTrue([snapshotStore writeContacts:NSOrderedSetMake(self.contact) error:nil]);
+
+    NSData *data = [NSData dataWithContentsOfURL:self.fileURL];
+    [[data subdataWithRange:NSMakeRange(0, data.length - 3)] writeToURL:self.fileURL atomically:YES];
+
+    NSError *error;
+    XCTAssertNil([snapshotStore readContactsWithError:&error]);
+    XCTAssertEqual(error.code, OHContactsSnapshotStoreErrorCodeCorrupted);
+}
+
+- (void)testMissingSnapshot
+{
+    OHContactsSnapshotStore *snapshotStore = [[OHContactsSnapshotStore alloc] initWithFileURL:self.fileURL contentVersion:1];
+    XCTAssertNil([snapshotStore readContactsWithError:nil]);
+}
+
+@end
@@ -0,0 +1,112 @@
+//
+//  OHDigitSearchUtilityTests.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <XCTest/XCTest.h>
+#import <Ohana/Ohana.h>
+
+#import "NSOrderedSetMake+Internal.h"
+
+@interface OHDigitSearchUtilityTests : XCTestCase
+
+@property (nonatomic) NSOrderedSet<OHContact *> *testContacts;
+
+@end
+
+@implementation OHDigitSearchUtilityTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    OHContact *contactA = [[OHContact alloc] init];
+    contactA.fullName = @"John Smith";
+    contactA.contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"mobile" value:@"(415) 555-1234" dataProviderIdentifier:@"test"],
+                                              [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:@"home" value:@"4155@example.com" dataProviderIdentifier:@"test"]);
+
+    OHContact *contactB = [[OHContact alloc] init];
+    contactB.firstName = @"José";
+    contactB.lastName = @"Núñez";
+    contactB.contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"home" value:@"+34 612 34 56 78" dataProviderIdentifier:@"test"],
+                                              [[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"work" value:@"+1 415-867-5309" dataProviderIdentifier:@"test"]);
+
+    OHContact *contactC = [[OHContact alloc] init];
+    contactC.fullName = @"Mary-Kate O'Brien";
+
+    self.testContacts = NSOrderedSetMake(contactA, contactB, contactC);
+}
+
+- (void)testSubstringSearch
+{
+    OHDigitSearchUtility *digitSearchUtility = [[OHDigitSearchUtility alloc] initWithContacts:self.testContacts];
+
+    XCTAssert([[digitSearchUtility contactsMatchingDigits:@"4155" mode:OHDigitSearchModeSubstring] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0])]);
+    XCTAssert([[digitSearchUtility contactsMatchingDigits:@"415" mode:OHDigitSearchModeSubstring] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0], self.testContacts[1])]);
+    XCTAssert([[digitSearchUtility contactsMatchingDigits:@"(555) 12" mode:OHDigitSearchModeSubstring] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0])]);
+    XCTAssertEqual([digitSearchUtility contactsMatchingDigits:@"999" mode:OHDigitSearchModeSubstring].count, 0);
+    XCTAssertEqual([digitSearchUtility contactsMatchingDigits:@"" mode:OHDigitSearchModeSubstring].count, 0);
+}
+
+- (void)testPrefixAndSuffixSearch
+{
+    OHDigitSearchUtility *digitSearchUtility = [[OHDigitSearchUtility alloc] initWithContacts:self.testContacts];
+
+    XCTAssert([[digitSearchUtility contactsMatchingDigits:@"415" mode:OHDigitSearchModePrefix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0])]);
+    XCTAssert([[digitSearchUtility contactsMatchingDigits:@"1415" mode:OHDigitSearchModePrefix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[1])]);
+    XCTAssert([[digitSearchUtility contactsMatchingDigits:@"5309" mode:OHDigitSearchModeSuffix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[1])]);
+    XCTAssertEqual([digitSearchUtility contactsMatchingDigits:@"555" mode:OHDigitSearchModeSuffix].count, 0);
+}
+
+- (void)testContactFieldsMatchingDigits
+{
+    OHDigitSearchUtility *digitSearchUtility = [[OHDigitSearchUtility alloc] initWithContacts:self.testContacts];
+
+    NSArray<OHContactField *> *contactFields = [digitSearchUtility contactFieldsMatchingDigits:@"415" mode:OHDigitSearchModeSubstring];
+    XCTAssertEqual(contactFields.count, 2);
+    XCTAssertEqual(contactFields[0], self.testContacts[0].contactFields[0]);
+    XCTAssertEqual(contactFields[1], self.testContacts[1].contactFields[1]);
+}
+
+- (void)testT9Search
+{
+    OHDigitSearchUtility *digitSearchUtility = [[OHDigitSearchUtility alloc] initWithContacts:self.testContacts];
+
+    // "john" is 5646, "smith" is 76484
+    XCTAssert([[digitSearchUtility contactsMatchingT9Digits:@"5646" mode:OHDigitSearchModePrefix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0])]);
+    XCTAssert([[digitSearchUtility contactsMatchingT9Digits:@"764" mode:OHDigitSearchModePrefix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0])]);
+    XCTAssert([[digitSearchUtility contactsMatchingT9Digits:@"484" mode:OHDigitSearchModeSuffix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0])]);
+
+    // Diacritics are folded, "jose" is 5673 and "nunez" is 68639
+    XCTAssert([[digitSearchUtility contactsMatchingT9Digits:@"5673" mode:OHDigitSearchModePrefix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[1])]);
+    XCTAssert([[digitSearchUtility contactsMatchingT9Digits:@"68639" mode:OHDigitSearchModePrefix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[1])]);
+
+    // Punctuation separates words, "kate" is 5283 and "brien" is 27436
+    XCTAssert([[digitSearchUtility contactsMatchingT9Digits:@"5283" mode:OHDigitSearchModePrefix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[2])]);
+    XCTAssert([[digitSearchUtility contactsMatchingT9Digits:@"27436" mode:OHDigitSearchModePrefix] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[2])]);
+
+    // Matches do not span words
+    XCTAssertEqual([digitSearchUtility contactsMatchingT9Digits:@"56467" mode:OHDigitSearchModeSubstring].count, 0);
+}
+
+@end
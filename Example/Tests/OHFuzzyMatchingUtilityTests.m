@@ -120,4 +120,137 @@
     XCTAssert([results isEqualToOrderedSet:expectedResults]);
 }
 
+- (void)testFuzzyMatchLimit
+{
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:self.testContacts];
+
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"test" limit:2] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0], self.testContacts[1])]);
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"test" limit:10] isEqualToOrderedSet:[fuzzyMatchingUtility contactsMatchingQuery:@"test"]]);
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"test" limit:0] isEqualToOrderedSet:[fuzzyMatchingUtility contactsMatchingQuery:@"test"]]);
+
+    fuzzyMatchingUtility.scoringBlock = ^NSInteger (NSString *query, NSString *nominee) {
+        return [nominee isEqualToString:@"Third Test Contact"] ? 1 : 0;
+    };
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"test" limit:2] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[2], self.testContacts[0])]);
+}
+
+- (void)testFuzzyMatchBuiltInScoring
+{
+    OHContact *johnContact = [[OHContact alloc] init];
+    johnContact.fullName = @"John Smith";
+    OHContact *jonesContact = [[OHContact alloc] init];
+    jonesContact.fullName = @"Bob Jones";
+    OHContact *majorContact = [[OHContact alloc] init];
+    majorContact.fullName = @"Major Tom";
+    OHContact *camelCaseContact = [[OHContact alloc] init];
+    camelCaseContact.contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypeOther label:@"test" value:@"FooBar" dataProviderIdentifier:@"test"]);
+    OHContact *fuzzboxContact = [[OHContact alloc] init];
+    fuzzboxContact.contactFields = NSOrderedSetMake([[OHContactField alloc] initWithType:OHContactFieldTypeOther label:@"test" value:@"fuzzbox" dataProviderIdentifier:@"test"]);
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:NSOrderedSetMake(majorContact, jonesContact, johnContact, fuzzboxContact, camelCaseContact)];
+
+    // Without scoring results keep their original order
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"jo"] isEqualToOrderedSet:NSOrderedSetMake(majorContact, jonesContact, johnContact)]);
+
+    fuzzyMatchingUtility.usesBuiltInScoring = YES;
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"jo"] isEqualToOrderedSet:NSOrderedSetMake(johnContact, jonesContact, majorContact)]);
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"jo" limit:1] isEqualToOrderedSet:NSOrderedSetMake(johnContact)]);
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"fb"] isEqualToOrderedSet:NSOrderedSetMake(camelCaseContact, fuzzboxContact)]);
+
+    // A scoring block takes precedence over the built-in score, and ties keep the original order
+    fuzzyMatchingUtility.scoringBlock = ^NSInteger (NSString *query, NSString *nominee) {
+        return -(NSInteger)nominee.length;
+    };
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"jo"] isEqualToOrderedSet:NSOrderedSetMake(majorContact, jonesContact, johnContact)]);
+}
+
+- (void)testFuzzyMatchIgnoresCase
+{
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:self.testContacts];
+
+    NSOrderedSet<OHContact *> *results = [fuzzyMatchingUtility contactsMatchingQuery:@"THRDtc"];
+    NSOrderedSet<OHContact *> *expectedResults = NSOrderedSetMake(self.testContacts[2]);
+
+    XCTAssert([results isEqualToOrderedSet:expectedResults]);
+}
+
+- (void)testFuzzyMatchRequiresOrder
+{
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:self.testContacts];
+
+    XCTAssertEqual([fuzzyMatchingUtility contactsMatchingQuery:@"tcatnoc"].count, 0);
+    XCTAssertEqual([fuzzyMatchingUtility contactsMatchingQuery:@"contactz"].count, 0);
+}
+
+- (void)testFuzzyMatchNonASCII
+{
+    OHContact *accentedContact = [[OHContact alloc] init];
+    accentedContact.fullName = @"Ángel Núñez";
+    OHContact *emojiContact = [[OHContact alloc] init];
+    emojiContact.fullName = @"Pizza 🍕 Place";
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:NSOrderedSetMake(accentedContact, emojiContact)];
+
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"ángel ñ"] isEqualToOrderedSet:NSOrderedSetMake(accentedContact)]);
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"ÁNÑ"] isEqualToOrderedSet:NSOrderedSetMake(accentedContact)]);
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"p🍕p"] isEqualToOrderedSet:NSOrderedSetMake(emojiContact)]);
+    XCTAssertEqual([fuzzyMatchingUtility contactsMatchingQuery:@"🍕🍕"].count, 0);
+}
+
+- (void)testFuzzyMatchTreatsQueryLiterally
+{
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:self.testContacts];
+
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"+1 (555)"] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0])]);
+    XCTAssertEqual([fuzzyMatchingUtility contactsMatchingQuery:@"t.t"].count, 0);
+}
+
+- (void)testSearchSessionMatchesFreshSearches
+{
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:self.testContacts];
+
+    NSArray<NSString *> *queries = @[@"t", @"te", @"tes", @"test", @"test c", @"test", @"tesx", @"tes", @"t", @"th", @"THI", @"", @"5", @"55", @"5551", @"contact", @"contacts", @"con"];
+    for (NSString *query in queries) {
+        OHFuzzyMatchingUtility *freshFuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:self.testContacts];
+        NSOrderedSet<OHContact *> *results = [fuzzyMatchingUtility contactsMatchingQuery:query];
+        NSOrderedSet<OHContact *> *expectedResults = [freshFuzzyMatchingUtility contactsMatchingQuery:query];
+        XCTAssert((!results && !expectedResults) || [results isEqualToOrderedSet:expectedResults], @"%@", query);
+    }
+
+    [fuzzyMatchingUtility resetSearchSession];
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"third"] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[2])]);
+}
+
+- (void)testIndexedFuzzyMatchMatchesScan
+{
+    OHSyntheticContactsDataProvider *dataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:500 seed:42];
+    NSOrderedSet<OHContact *> *contacts = [dataProvider fetchContactsWithIdentifiers:nil error:nil];
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:contacts];
+    OHFuzzyMatchingUtility *indexedFuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:contacts indexingMode:OHFuzzyMatchingIndexingModeInline];
+
+    XCTAssertFalse(fuzzyMatchingUtility.indexReady);
+    XCTAssertTrue(indexedFuzzyMatchingUtility.indexReady);
+    XCTAssertGreaterThan(indexedFuzzyMatchingUtility.indexSize, 0);
+    XCTAssertGreaterThan(indexedFuzzyMatchingUtility.indexBuildDuration, 0);
+
+    for (NSString *query in @[@"j", @"jsmth", @"415", @"MARÍA", @"gmail", @"zzzz", @"müller", @"@"]) {
+        [fuzzyMatchingUtility resetSearchSession];
+        [indexedFuzzyMatchingUtility resetSearchSession];
+        XCTAssert([[indexedFuzzyMatchingUtility contactsMatchingQuery:query] isEqualToOrderedSet:[fuzzyMatchingUtility contactsMatchingQuery:query]], @"%@", query);
+    }
+}
+
+- (void)testBackgroundIndexing
+{
+    OHFuzzyMatchingUtility *fuzzyMatchingUtility = [[OHFuzzyMatchingUtility alloc] initWithContacts:self.testContacts indexingMode:OHFuzzyMatchingIndexingModeBackground];
+
+    // Queries are answered by scanning until the index is ready
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"contact"] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0], self.testContacts[1], self.testContacts[2])]);
+
+    [self expectationForPredicate:[NSPredicate predicateWithFormat:@"indexReady == YES"] evaluatedWithObject:fuzzyMatchingUtility handler:nil];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+
+    [fuzzyMatchingUtility resetSearchSession];
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"contact"] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0], self.testContacts[1], self.testContacts[2])]);
+    XCTAssert([[fuzzyMatchingUtility contactsMatchingQuery:@"5551357"] isEqualToOrderedSet:NSOrderedSetMake(self.testContacts[0])]);
+}
+
 @end
@@ -165,6 +165,11 @@
     OCMStub([dataProviderMock onContactsDataProviderFinishedLoadingSignal]).andReturn(onContactsDataProviderFinishedLoadingSignal);
     OHContactsDataProviderErrorSignal *onContactsDataProviderErrorSignal = [[OHContactsDataProviderErrorSignal alloc] init];
     OCMStub([dataProviderMock onContactsDataProviderErrorSignal]).andReturn(onContactsDataProviderErrorSignal);
+    OHContactsDataProviderBatchLoadedSignal *onContactsDataProviderBatchLoadedSignal = [[OHContactsDataProviderBatchLoadedSignal alloc] init];
+    OCMStub([dataProviderMock onContactsDataProviderBatchLoadedSignal]).andReturn(onContactsDataProviderBatchLoadedSignal);
+    OCMStub([dataProviderMock lastLoadTransformDuration]).andReturn(0.0);
+    OCMStub([dataProviderMock cancelLoading]);
+    OCMStub([dataProviderMock contactIdentifierForContact:OCMOCK_ANY]).andReturn(nil);
     OCMStub([dataProviderMock loadContacts]).andDo(^(NSInvocation *invocation) {
         [dataProviderMock onContactsDataProviderFinishedLoadingSignal].fire(dataProviderMock);
     });
@@ -106,4 +106,40 @@
     XCTAssertNil(formattedRFC3966);
 }
 
+- (void)testFormattingOnDemand
+{
+    OHContactField *contactField = [[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber
+                                                                  label:@"test"
+                                                                  value:@"555-5555555"
+                                                 dataProviderIdentifier:@"test"];
+    OHContactField *emailField = [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress
+                                                                label:@"test"
+                                                                value:@"a@b.c"
+                                               dataProviderIdentifier:@"test"];
+    OHContact *contact = [[OHContact alloc] init];
+    contact.contactFields = NSOrderedSetMake(contactField, emailField);
+
+    OHPhoneNumberFormattingPostProcessor *realPostProcessor = [[OHPhoneNumberFormattingPostProcessor alloc] initWithFormats:OHPhoneNumberFormatE164|OHPhoneNumberFormatNational];
+    realPostProcessor.formatsOnDemand = YES;
+    id postProcessor = OCMPartialMock(realPostProcessor);
+    OCMStub([postProcessor _countryCode]).andReturn(@"US");
+    [postProcessor processContacts:NSOrderedSetMake(contact)];
+
+    XCTAssertEqual(contactField.customProperties.count, 0);
+    XCTAssertNil(emailField.customPropertyProviders);
+
+    XCTAssertEqualObjects([contactField customPropertyForKey:kOHFormattedPhoneNumberE164], @"+15555555555");
+    XCTAssertEqualObjects([contactField customPropertyForKey:kOHFormattedPhoneNumberNational], @"(555) 555-5555");
+    XCTAssertNil([contactField customPropertyForKey:kOHFormattedPhoneNumberInternational]);
+    XCTAssertNil([contactField customPropertyForKey:kOHFormattedPhoneNumberRFC3966]);
+}
+
+- (void)testFormattingOnDemandChangesFingerprint
+{
+    OHPhoneNumberFormattingPostProcessor *postProcessor = [[OHPhoneNumberFormattingPostProcessor alloc] initWithFormats:OHPhoneNumberFormatE164];
+    NSString *eagerFingerprint = [postProcessor configurationFingerprint];
+    postProcessor.formatsOnDemand = YES;
+    XCTAssertNotEqualObjects([postProcessor configurationFingerprint], eagerFingerprint);
+}
+
 @end
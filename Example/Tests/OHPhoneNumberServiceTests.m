@@ -0,0 +1,103 @@
+//
+//  OHPhoneNumberServiceTests.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <XCTest/XCTest.h>
+#import <Ohana/Ohana.h>
+
+@interface OHPhoneNumberServiceTests : XCTestCase
+
+@end
+
+@implementation OHPhoneNumberServiceTests
+
+- (void)setUp
+{
+    [super setUp];
+
+    [[OHPhoneNumberService sharedService] removeAllCachedPhoneNumbers];
+}
+
+- (void)testSharedService
+{
+    XCTAssertNotNil([OHPhoneNumberService sharedService]);
+    XCTAssertEqual([OHPhoneNumberService sharedService], [OHPhoneNumberService sharedService]);
+}
+
+- (void)testFormattedPhoneNumbers
+{
+    OHPhoneNumberService *phoneNumberService = [OHPhoneNumberService sharedService];
+    [phoneNumberService prewarmForRegion:@"US"];
+
+    NSDictionary<NSNumber *, NSString *> *formattedPhoneNumbers = [phoneNumberService formattedPhoneNumbers:@"555-5555555"
+                                                                                                    formats:OHPhoneNumberFormatE164|OHPhoneNumberFormatNational
+                                                                                              defaultRegion:@"US"];
+    XCTAssertEqual(formattedPhoneNumbers.count, 2);
+    XCTAssertEqualObjects([formattedPhoneNumbers objectForKey:@(OHPhoneNumberFormatE164)], @"+15555555555");
+    XCTAssertEqualObjects([formattedPhoneNumbers objectForKey:@(OHPhoneNumberFormatNational)], @"(555) 555-5555");
+
+    XCTAssertEqualObjects([phoneNumberService formattedPhoneNumber:@"555-5555555" format:OHPhoneNumberFormatInternational defaultRegion:@"US"], @"+1 555-555-5555");
+    XCTAssertEqualObjects([phoneNumberService formattedPhoneNumber:@"555-5555555" format:OHPhoneNumberFormatRFC3966 defaultRegion:@"US"], @"tel:+1-555-555-5555");
+}
+
+- (void)testFormattingDependsOnRegion
+{
+    OHPhoneNumberService *phoneNumberService = [OHPhoneNumberService sharedService];
+
+    XCTAssertEqualObjects([phoneNumberService formattedPhoneNumber:@"612345678" format:OHPhoneNumberFormatE164 defaultRegion:@"ES"], @"+34612345678");
+    XCTAssertEqualObjects([phoneNumberService formattedPhoneNumber:@"555-5555555" format:OHPhoneNumberFormatE164 defaultRegion:@"US"], @"+15555555555");
+}
+
+- (void)testCachedResultsAreStable
+{
+    OHPhoneNumberService *phoneNumberService = [OHPhoneNumberService sharedService];
+
+    NSString *firstResult = [phoneNumberService formattedPhoneNumber:@"555-5555555" format:OHPhoneNumberFormatE164 defaultRegion:@"US"];
+    NSString *secondResult = [phoneNumberService formattedPhoneNumber:@"555-5555555" format:OHPhoneNumberFormatE164 defaultRegion:@"US"];
+    XCTAssertEqualObjects(firstResult, secondResult);
+
+    [phoneNumberService removeAllCachedPhoneNumbers];
+    XCTAssertEqualObjects([phoneNumberService formattedPhoneNumber:@"555-5555555" format:OHPhoneNumberFormatE164 defaultRegion:@"US"], firstResult);
+}
+
+- (void)testUnparsablePhoneNumber
+{
+    OHPhoneNumberService *phoneNumberService = [OHPhoneNumberService sharedService];
+
+    XCTAssertEqual([phoneNumberService formattedPhoneNumbers:@"not a number" formats:OHPhoneNumberFormatE164|OHPhoneNumberFormatNational defaultRegion:@"US"].count, 0);
+    XCTAssertNil([phoneNumberService formattedPhoneNumber:@"not a number" format:OHPhoneNumberFormatE164 defaultRegion:@"US"]);
+}
+
+- (void)testConcurrentFormatting
+{
+    OHPhoneNumberService *phoneNumberService = [OHPhoneNumberService sharedService];
+
+    dispatch_apply(64, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        NSString *phoneNumber = [NSString stringWithFormat:@"555-55555%02zu", iteration % 8];
+        NSString *formattedPhoneNumber = [phoneNumberService formattedPhoneNumber:phoneNumber format:OHPhoneNumberFormatE164 defaultRegion:@"US"];
+        XCTAssertEqualObjects(formattedPhoneNumber, ([NSString stringWithFormat:@"+155555555%02zu", iteration % 8]));
+    });
+}
+
+@end
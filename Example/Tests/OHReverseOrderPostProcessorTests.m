@@ -45,4 +45,14 @@
     XCTAssert([result isEqualToOrderedSet:expectedResult]);
 }
 
+- (void)testReverseOrderIndexVector
+{
+    NSOrderedSet<OHContact *> *contacts = NSOrderedSetMake([[OHContact alloc] init], [[OHContact alloc] init], [[OHContact alloc] init]);
+
+    OHReverseOrderPostProcessor *processor = [[OHReverseOrderPostProcessor alloc] init];
+    OHContactsIndexVector *result = [processor processIndexVector:[[OHContactsIndexVector alloc] initWithContacts:contacts]];
+    NSOrderedSet<OHContact *> *expectedResult = NSOrderedSetMake(contacts[2], contacts[1], contacts[0]);
+    XCTAssert([[result contacts] isEqualToOrderedSet:expectedResult]);
+}
+
 @end
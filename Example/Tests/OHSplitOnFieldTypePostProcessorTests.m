@@ -107,4 +107,21 @@
     XCTAssertEqual(results.count, (NSUInteger)0);
 }
 
+- (void)testSplitContactsDoNotChangeOriginals
+{
+    OHSplitOnFieldTypePostProcessor *postProcessor = [[OHSplitOnFieldTypePostProcessor alloc] initWithFieldType:OHContactFieldTypePhoneNumber];
+    NSOrderedSet<OHContact *> *results = [postProcessor processContacts:self.testContacts];
+
+    XCTAssert([results[0] isKindOfClass:[OHContactProjection class]]);
+    XCTAssertEqual(results[0].contactFields.count, (NSUInteger)1);
+
+    results[0].fullName = @"changed";
+    [results[0].tags addObject:@"tag"];
+    XCTAssertEqualObjects(results[0].fullName, @"changed");
+    XCTAssertEqualObjects(results[1].fullName, @"email and phone contact");
+    XCTAssertEqualObjects(self.testContacts[0].fullName, @"email and phone contact");
+    XCTAssertEqual(self.testContacts[0].tags.count, (NSUInteger)0);
+    XCTAssertEqual(self.testContacts[0].contactFields.count, (NSUInteger)4);
+}
+
 @end
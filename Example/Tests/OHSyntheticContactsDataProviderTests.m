@@ -0,0 +1,140 @@
+//
+//  OHSyntheticContactsDataProviderTests.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <XCTest/XCTest.h>
+#import <Ohana/Ohana.h>
+
+@interface OHSyntheticContactsDataProviderTests : XCTestCase
+
+@end
+
+@implementation OHSyntheticContactsDataProviderTests
+
+- (void)testLoadContactsIsDeterministic
+{
+    OHSyntheticContactsDataProvider *dataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:200 seed:42];
+    OHSyntheticContactsDataProvider *otherDataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:200 seed:42];
+
+    __block BOOL didFinishLoading = NO;
+    [dataProvider.onContactsDataProviderFinishedLoadingSignal addObserver:self callback:^(typeof(self) self, id<OHContactsDataProviderProtocol> dataProvider) {
+        didFinishLoading = YES;
+    }];
+    [dataProvider loadContacts];
+    [otherDataProvider loadContacts];
+
+    XCTAssertTrue(didFinishLoading);
+    XCTAssertEqual(dataProvider.status, OHContactsDataProviderStatusLoaded);
+    XCTAssertEqual(dataProvider.contacts.count, 200);
+    for (NSUInteger i = 0; i < dataProvider.contacts.count; i++) {
+        XCTAssertEqual([dataProvider.contacts objectAtIndex:i].contentFingerprint, [otherDataProvider.contacts objectAtIndex:i].contentFingerprint);
+    }
+
+    OHSyntheticContactsDataProvider *differentDataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:200 seed:43];
+    [differentDataProvider loadContacts];
+    XCTAssertNotEqual(dataProvider.contacts.firstObject.contentFingerprint, differentDataProvider.contacts.firstObject.contentFingerprint);
+}
+
+- (void)testLoadContactsInBatches
+{
+    OHSyntheticContactsDataProvider *dataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:25 seed:1];
+    dataProvider.batchSize = 10;
+
+    NSMutableArray<NSNumber *> *batchCounts = [[NSMutableArray alloc] init];
+    [dataProvider.onContactsDataProviderBatchLoadedSignal addObserver:self callback:^(typeof(self) self, NSOrderedSet<OHContact *> *contacts, id<OHContactsDataProviderProtocol> dataProvider) {
+        [batchCounts addObject:@(contacts.count)];
+    }];
+    [dataProvider loadContacts];
+
+    XCTAssertEqualObjects(batchCounts, (@[@10, @10, @5]));
+    XCTAssertEqual(dataProvider.contacts.count, 25);
+}
+
+- (void)testLoadContactsWithLatency
+{
+    OHSyntheticContactsDataProvider *dataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:10 seed:1];
+    dataProvider.latency = 0.05;
+    dataProvider.latencyJitter = 0.05;
+
+    XCTestExpectation *finishedLoadingExpectation = [self expectationWithDescription:@"Data provider should have finished loading"];
+    [dataProvider.onContactsDataProviderFinishedLoadingSignal addObserver:self callback:^(typeof(self) self, id<OHContactsDataProviderProtocol> dataProvider) {
+        [finishedLoadingExpectation fulfill];
+    }];
+    [dataProvider loadContacts];
+
+    XCTAssertNil(dataProvider.contacts);
+    [self waitForExpectationsWithTimeout:1.0 handler:nil];
+    XCTAssertEqual(dataProvider.contacts.count, 10);
+}
+
+- (void)testCancelLoading
+{
+    OHSyntheticContactsDataProvider *dataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:10 seed:1];
+    dataProvider.latency = 0.05;
+
+    [dataProvider.onContactsDataProviderFinishedLoadingSignal addObserver:self callback:^(typeof(self) self, id<OHContactsDataProviderProtocol> dataProvider) {
+        XCTAssert(NO);
+    }];
+    [dataProvider loadContacts];
+    [dataProvider cancelLoading];
+
+    XCTAssertEqual(dataProvider.status, OHContactsDataProviderStatusInitialized);
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+    XCTAssertNil(dataProvider.contacts);
+}
+
+- (void)testLoadContactsWithErrors
+{
+    OHSyntheticContactsDataProvider *dataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:10 seed:1];
+    dataProvider.errorRate = 1.0;
+
+    __block NSError *loadingError;
+    [dataProvider.onContactsDataProviderErrorSignal addObserver:self callback:^(typeof(self) self, NSError *error, id<OHContactsDataProviderProtocol> dataProvider) {
+        loadingError = error;
+    }];
+    [dataProvider loadContacts];
+
+    XCTAssertEqualObjects(loadingError.domain, OHContactsDataProviderErrorDomain);
+    XCTAssertEqual(dataProvider.status, OHContactsDataProviderStatusError);
+    XCTAssertNil(dataProvider.contacts);
+}
+
+- (void)testFetchContactsWithIdentifiers
+{
+    OHSyntheticContactsDataProvider *dataProvider = [[OHSyntheticContactsDataProvider alloc] initWithContactCount:50 seed:7];
+    dataProvider.duplicateRate = 0.5;
+    [dataProvider loadContacts];
+
+    OHContact *contact = [dataProvider.contacts objectAtIndex:30];
+    NSString *contactIdentifier = [dataProvider contactIdentifierForContact:contact];
+    XCTAssertNotNil(contactIdentifier);
+
+    NSOrderedSet<OHContact *> *fetchedContacts = [dataProvider fetchContactsWithIdentifiers:[NSSet setWithObjects:contactIdentifier, @"unknown", nil] error:nil];
+    XCTAssertEqual(fetchedContacts.count, 1);
+    XCTAssertEqual(fetchedContacts.firstObject.contentFingerprint, contact.contentFingerprint);
+    XCTAssertEqualObjects([dataProvider contactIdentifierForContact:fetchedContacts.firstObject], contactIdentifier);
+}
+
+@end
@@ -0,0 +1,42 @@
+//
+//  OHABAddressBookChangeSource.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <AddressBook/AddressBook.h>
+
+#import "OHContactsChangeSourceProtocol.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Change source firing whenever the address book reports an external change
+ *
+ *  @discussion The address book does not say which contacts changed, so the signal is always fired with nil contact identifiers. Changes are
+ *  reported on the run loop of the thread that created the change source.
+ */
+@interface OHABAddressBookChangeSource : NSObject <OHContactsChangeSourceProtocol>
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,74 @@
+//
+//  OHABAddressBookChangeSource.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHABAddressBookChangeSource.h"
+
+@interface OHABAddressBookChangeSource ()
+
+@property (nonatomic, nullable) ABAddressBookRef addressBook;
+
+- (void)_addressBookDidChange;
+
+@end
+
+static void OHABAddressBookExternalChangeCallback(ABAddressBookRef addressBook, CFDictionaryRef info, void *context)
+{
+    OHABAddressBookChangeSource *changeSource = (__bridge OHABAddressBookChangeSource *)context;
+    [changeSource _addressBookDidChange];
+}
+
+@implementation OHABAddressBookChangeSource
+
+@synthesize onContactsChangeSourceChangedSignal = _onContactsChangeSourceChangedSignal;
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _onContactsChangeSourceChangedSignal = [[OHContactsChangeSourceChangedSignal alloc] init];
+
+        _addressBook = ABAddressBookCreateWithOptions(NULL, NULL);
+        if (_addressBook) {
+            ABAddressBookRegisterExternalChangeCallback(_addressBook, OHABAddressBookExternalChangeCallback, (__bridge void *)self);
+        }
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    if (_addressBook) {
+        ABAddressBookUnregisterExternalChangeCallback(_addressBook, OHABAddressBookExternalChangeCallback, (__bridge void *)self);
+        CFRelease(_addressBook);
+    }
+}
+
+#pragma mark - Private
+
+- (void)_addressBookDidChange
+{
+    self.onContactsChangeSourceChangedSignal.fire(nil, self);
+}
+
+@end
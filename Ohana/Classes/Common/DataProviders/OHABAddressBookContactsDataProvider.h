@@ -45,6 +45,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface OHABAddressBookContactsDataProvider : NSObject <OHContactsDataProviderProtocol>
 
+extern NSString *_Nonnull kOHABAddressBookContactsDataProviderRecordIdentifierKey;  // Record identifier unique among contacts in the address book (NSString *)
+
 - (instancetype)initWithDelegate:(id<OHABAddressBookContactsDataProviderDelegate>)delegate NS_DESIGNATED_INITIALIZER;
 
 - (instancetype)init NS_UNAVAILABLE;
@@ -43,17 +43,25 @@ typedef void (^OHABContactsFetchFailedBlock)(NSError *error);
 
 @property (nonatomic, weak, readonly) id<OHABAddressBookContactsDataProviderDelegate> delegate;
 
+/**
+ *  Incremented by cancelLoading, a read stops when it no longer matches the value it started with
+ */
+@property (atomic) NSUInteger loadGeneration;
+
 @end
 
 @implementation OHABAddressBookContactsDataProvider
 
-@synthesize onContactsDataProviderFinishedLoadingSignal = _onContactsDataProviderFinishedLoadingSignal, onContactsDataProviderErrorSignal = _onContactsDataProviderErrorSignal, status = _status, contacts = _contacts;
+@synthesize onContactsDataProviderFinishedLoadingSignal = _onContactsDataProviderFinishedLoadingSignal, onContactsDataProviderErrorSignal = _onContactsDataProviderErrorSignal, status = _status, contacts = _contacts, onContactsDataProviderBatchLoadedSignal = _onContactsDataProviderBatchLoadedSignal, batchSize = _batchSize, lastLoadTransformDuration = _lastLoadTransformDuration;
+
+const NSString *kOHABAddressBookContactsDataProviderRecordIdentifierKey = @"kOHABAddressBookContactsDataProviderRecordIdentifierKey";
 
 - (instancetype)initWithDelegate:(id<OHABAddressBookContactsDataProviderDelegate>)delegate
 {
     if (self = [super init]) {
         _onContactsDataProviderFinishedLoadingSignal = [[OHContactsDataProviderFinishedLoadingSignal alloc] init];
         _onContactsDataProviderErrorSignal = [[OHContactsDataProviderErrorSignal alloc] init];
+        _onContactsDataProviderBatchLoadedSignal = [[OHContactsDataProviderBatchLoadedSignal alloc] init];
         _status = OHContactsDataProviderStatusInitialized;
         _delegate = delegate;
     }
@@ -90,6 +98,57 @@ typedef void (^OHABContactsFetchFailedBlock)(NSError *error);
     return NSStringFromClass([OHABAddressBookContactsDataProvider class]);
 }
 
+- (void)cancelLoading
+{
+    if (_status == OHContactsDataProviderStatusProcessing) {
+        self.loadGeneration++;
+        _status = OHContactsDataProviderStatusInitialized;
+    }
+}
+
+- (NSString *)contactIdentifierForContact:(OHContact *)contact
+{
+    return [contact.customProperties objectForKey:kOHABAddressBookContactsDataProviderRecordIdentifierKey];
+}
+
+- (NSOrderedSet<OHContact *> *)fetchContactsWithIdentifiers:(NSSet<NSString *> *)contactIdentifiers error:(NSError **)error
+{
+    if ([self _authorizationStatus] != kABAuthorizationStatusAuthorized) {
+        if (error) {
+            *error = [NSError errorWithDomain:OHContactsDataProviderErrorDomain code:OHContactsDataProviderErrorCodeAuthenticationError userInfo:nil];
+        }
+        return nil;
+    }
+
+    CFErrorRef addressBookError = NULL;
+    ABAddressBookRef addressBook = ABAddressBookCreateWithOptions(NULL, &addressBookError);
+    if (!addressBook) {
+        if (error) {
+            *error = (__bridge_transfer NSError *)addressBookError;
+        }
+        return nil;
+    }
+
+    __block NSOrderedSet<OHContact *> *contacts = nil;
+    if (contactIdentifiers) {
+        NSMutableOrderedSet<OHContact *> *fetchedContacts = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:contactIdentifiers.count];
+        for (NSString *contactIdentifier in contactIdentifiers) {
+            ABRecordRef record = ABAddressBookGetPersonWithRecordID(addressBook, (ABRecordID)contactIdentifier.intValue);
+            if (record) {
+                [fetchedContacts addObject:[self _transformABRecordToOHContactWithRecord:record]];
+            }
+        }
+        contacts = fetchedContacts;
+    } else {
+        [self _readAddressBookContacts:addressBook forLoad:NO completion:^(NSOrderedSet<OHContact *> *records) {
+            contacts = records ?: [NSOrderedSet orderedSet];
+        }];
+    }
+    CFRelease(addressBook);
+
+    return contacts;
+}
+
 #pragma mark - Private
 
 - (void)triggerUserAuthentication
@@ -106,7 +165,7 @@ typedef void (^OHABContactsFetchFailedBlock)(NSError *error);
     ABAddressBookRef addressBook = ABAddressBookCreateWithOptions(NULL, NULL);
     [self _requestAddressBookAccessWithAddressBook:addressBook completion:^(bool granted, CFErrorRef error) {
         if (granted && !error) {
-            [self _readAddressBookContacts:addressBook completion:^(NSOrderedSet<OHContact *> *records) {
+            [self _readAddressBookContacts:addressBook forLoad:YES completion:^(NSOrderedSet<OHContact *> *records) {
                 success(records);
             }];
         } else {
@@ -119,14 +178,39 @@ typedef void (^OHABContactsFetchFailedBlock)(NSError *error);
     }];
 }
 
-- (void)_readAddressBookContacts:(ABAddressBookRef)addressBook completion:(void (^)(NSOrderedSet<OHContact *> *records))completion
+/**
+ *  Reads all contacts, stopping without calling the completion block if cancelLoading is called while reading
+ *
+ *  @param isLoad Whether the read is part of loadContacts, which fires batches and records lastLoadTransformDuration, or a refresh, which does neither
+ */
+- (void)_readAddressBookContacts:(ABAddressBookRef)addressBook forLoad:(BOOL)isLoad completion:(void (^)(NSOrderedSet<OHContact *> *records))completion
 {
+    NSUInteger loadGeneration = self.loadGeneration;
     CFArrayRef peopleRecordRefs = [self _copyArrayOfAllPeopleFromAddressBook:addressBook];
     if (peopleRecordRefs) {
         long peopleRecordRefsCount = CFArrayGetCount(peopleRecordRefs);
         NSMutableOrderedSet<OHContact *> *ubContactsArray = [NSMutableOrderedSet orderedSetWithCapacity:(NSUInteger)peopleRecordRefsCount];
-        for (long i = 0; i < peopleRecordRefsCount; i++) {
-            [ubContactsArray addObject:[self _transformABRecordToOHContactWithRecord:CFArrayGetValueAtIndex(peopleRecordRefs, i)]];
+        long sliceLength = isLoad && self.batchSize ? (long)self.batchSize : peopleRecordRefsCount;
+        NSTimeInterval transformDuration = 0;
+        for (long sliceStart = 0; sliceStart < peopleRecordRefsCount; sliceStart += sliceLength) {
+            long sliceEnd = MIN(sliceStart + sliceLength, peopleRecordRefsCount);
+            NSMutableOrderedSet<OHContact *> *batch = [NSMutableOrderedSet orderedSetWithCapacity:(NSUInteger)(sliceEnd - sliceStart)];
+            CFAbsoluteTime transformStartTime = CFAbsoluteTimeGetCurrent();
+            for (long i = sliceStart; i < sliceEnd; i++) {
+                if (loadGeneration != self.loadGeneration) {
+                    CFRelease(peopleRecordRefs);
+                    return;
+                }
+                [batch addObject:[self _transformABRecordToOHContactWithRecord:CFArrayGetValueAtIndex(peopleRecordRefs, i)]];
+            }
+            transformDuration += CFAbsoluteTimeGetCurrent() - transformStartTime;
+            [ubContactsArray unionOrderedSet:batch];
+            if (isLoad && self.batchSize) {
+                self.onContactsDataProviderBatchLoadedSignal.fire(batch, self);
+            }
+        }
+        if (isLoad) {
+            _lastLoadTransformDuration = transformDuration;
         }
         completion(ubContactsArray);
         CFRelease(peopleRecordRefs);
@@ -138,6 +222,7 @@ typedef void (^OHABContactsFetchFailedBlock)(NSError *error);
 - (OHContact *)_transformABRecordToOHContactWithRecord:(ABRecordRef)record
 {
     OHContact *contact = [[OHContact alloc] init];
+    [contact.customProperties setObject:[NSString stringWithFormat:@"%d", ABRecordGetRecordID(record)] forKey:kOHABAddressBookContactsDataProviderRecordIdentifierKey];
     contact.firstName = [self _stringForABPropertyId:kABPersonFirstNameProperty record:record];
     contact.lastName = [self _stringForABPropertyId:kABPersonLastNameProperty record:record];
     contact.fullName = [self _fullNameForRecord:record];
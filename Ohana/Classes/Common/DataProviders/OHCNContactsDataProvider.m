@@ -33,12 +33,17 @@ typedef void (^OHCNContactsDataProviderFetchFailedBlock)(NSError *error);
 
 @property (nonatomic, weak, readonly) id<OHCNContactsDataProviderDelegate> delegate;
 
+/**
+ *  Incremented by cancelLoading, a fetch stops when it no longer matches the value it started with
+ */
+@property (atomic) NSUInteger loadGeneration;
+
 @end
 
 
 @implementation OHCNContactsDataProvider
 
-@synthesize onContactsDataProviderFinishedLoadingSignal = _onContactsDataProviderFinishedLoadingSignal,onContactsDataProviderErrorSignal = _onContactsDataProviderErrorSignal, status = _status, contacts = _contacts;
+@synthesize onContactsDataProviderFinishedLoadingSignal = _onContactsDataProviderFinishedLoadingSignal,onContactsDataProviderErrorSignal = _onContactsDataProviderErrorSignal, status = _status, contacts = _contacts, onContactsDataProviderBatchLoadedSignal = _onContactsDataProviderBatchLoadedSignal, batchSize = _batchSize, lastLoadTransformDuration = _lastLoadTransformDuration;
 
 const NSString *kOHCNContactsDataProviderContactIdentifierKey = @"kOHCNContactsDataProviderContactIdentifierKey";
 
@@ -47,6 +52,7 @@ const NSString *kOHCNContactsDataProviderContactIdentifierKey = @"kOHCNContactsD
     if (self = [super init]) {
         _onContactsDataProviderFinishedLoadingSignal = [[OHContactsDataProviderFinishedLoadingSignal alloc] init];
         _onContactsDataProviderErrorSignal = [[OHContactsDataProviderErrorSignal alloc] init];
+        _onContactsDataProviderBatchLoadedSignal = [[OHContactsDataProviderBatchLoadedSignal alloc] init];
         _status = OHContactsDataProviderStatusInitialized;
         _delegate = delegate;
     }
@@ -64,7 +70,7 @@ const NSString *kOHCNContactsDataProviderContactIdentifierKey = @"kOHCNContactsD
         }];
     } else if ([self _authorizationStatus] == CNAuthorizationStatusAuthorized) {
         _status = OHContactsDataProviderStatusProcessing;
-        [self _fetchContactsWithSuccess:^(NSOrderedSet<OHContact *> *contacts) {
+        [self _fetchContactsForLoad:YES success:^(NSOrderedSet<OHContact *> *contacts) {
             _contacts = contacts;
             _status = OHContactsDataProviderStatusLoaded;
             self.onContactsDataProviderFinishedLoadingSignal.fire(self);
@@ -83,6 +89,50 @@ const NSString *kOHCNContactsDataProviderContactIdentifierKey = @"kOHCNContactsD
     return NSStringFromClass([OHCNContactsDataProvider class]);
 }
 
+- (void)cancelLoading
+{
+    if (_status == OHContactsDataProviderStatusProcessing) {
+        self.loadGeneration++;
+        _status = OHContactsDataProviderStatusInitialized;
+    }
+}
+
+- (NSString *)contactIdentifierForContact:(OHContact *)contact
+{
+    return [contact.customProperties objectForKey:kOHCNContactsDataProviderContactIdentifierKey];
+}
+
+- (NSOrderedSet<OHContact *> *)fetchContactsWithIdentifiers:(NSSet<NSString *> *)contactIdentifiers error:(NSError **)error
+{
+    if (!contactIdentifiers) {
+        __block NSOrderedSet<OHContact *> *fetchedContacts = nil;
+        __block NSError *fetchError = nil;
+        [self _fetchContactsForLoad:NO success:^(NSOrderedSet<OHContact *> *contacts) {
+            fetchedContacts = contacts;
+        } failure:^(NSError *failureError) {
+            fetchError = failureError;
+        }];
+        if (error) {
+            *error = fetchError;
+        }
+        return fetchedContacts;
+    }
+
+    CNContactStore *contactStore = [[CNContactStore alloc] init];
+    NSArray<CNContact *> *cnContacts = [contactStore unifiedContactsMatchingPredicate:[CNContact predicateForContactsWithIdentifiers:contactIdentifiers.allObjects]
+                                                                          keysToFetch:[self _keysToFetch]
+                                                                                error:error];
+    if (!cnContacts) {
+        return nil;
+    }
+
+    NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:cnContacts.count];
+    for (CNContact *cnContact in cnContacts) {
+        [contacts addObject:[self _contactForCNContact:cnContact]];
+    }
+    return contacts;
+}
+
 #pragma mark - Private
 
 - (void)triggerUserAuthentication
@@ -100,24 +150,18 @@ const NSString *kOHCNContactsDataProviderContactIdentifierKey = @"kOHCNContactsD
     return [CNContactStore authorizationStatusForEntityType:CNEntityTypeContacts];
 }
 
-- (void)_fetchContactsWithSuccess:(OHCNContactsDataProviderFetchCompletionBlock)success failure:(OHCNContactsDataProviderFetchFailedBlock)failure
+/**
+ *  Fetches all contacts, stopping without calling either block if cancelLoading is called while fetching
+ *
+ *  @param isLoad Whether the fetch is part of loadContacts, which fires batches and records lastLoadTransformDuration, or a refresh, which does neither
+ */
+- (void)_fetchContactsForLoad:(BOOL)isLoad success:(OHCNContactsDataProviderFetchCompletionBlock)success failure:(OHCNContactsDataProviderFetchFailedBlock)failure
 {
+    NSUInteger loadGeneration = self.loadGeneration;
     CNContactStore *contactStore = [[CNContactStore alloc] init];
     NSError *error;
 
-    NSMutableArray *keysToFetch = [NSMutableArray arrayWithObjects:[CNContactFormatter descriptorForRequiredKeysForStyle:CNContactFormatterStyleFullName],
-                                                                   CNContactEmailAddressesKey,
-                                                                   CNContactPhoneNumbersKey,
-                                                                   CNContactUrlAddressesKey,
-                                                                   CNContactPostalAddressesKey,
-                                                                   CNContactOrganizationNameKey,
-                                                                   CNContactJobTitleKey,
-                                                                   CNContactDepartmentNameKey,
-                                                                   nil];
-
-    if (self.loadThumbnailImage) {
-        [keysToFetch addObject:CNContactThumbnailImageDataKey];
-    }
+    NSArray *keysToFetch = [self _keysToFetch];
 
     NSArray<CNContainer *> *containters = [contactStore containersMatchingPredicate:nil error:&error];
 
@@ -126,27 +170,72 @@ const NSString *kOHCNContactsDataProviderContactIdentifierKey = @"kOHCNContactsD
         return;
     }
 
-    NSMutableArray<CNContact *> *cnContacts = [[NSMutableArray alloc] init];
+    // Contacts are transformed while they are enumerated so that batches can be fired before the whole contact store has been read
+    NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
+    __block NSMutableOrderedSet<OHContact *> *batch = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:self.batchSize];
+    __block NSTimeInterval transformDuration = 0;
     for (CNContainer *containter in containters) {
-        NSArray<CNContact *> *contactsInContainer = [contactStore unifiedContactsMatchingPredicate:[CNContact predicateForContactsInContainerWithIdentifier:containter.identifier]
-                                                                                       keysToFetch:keysToFetch
-                                                                                             error:&error];
+        CNContactFetchRequest *fetchRequest = [[CNContactFetchRequest alloc] initWithKeysToFetch:keysToFetch];
+        fetchRequest.predicate = [CNContact predicateForContactsInContainerWithIdentifier:containter.identifier];
+
+        __block BOOL cancelled = NO;
+        [contactStore enumerateContactsWithFetchRequest:fetchRequest error:&error usingBlock:^(CNContact *cnContact, BOOL *stop) {
+            if (loadGeneration != self.loadGeneration) {
+                cancelled = YES;
+                *stop = YES;
+                return;
+            }
+
+            CFAbsoluteTime transformStartTime = CFAbsoluteTimeGetCurrent();
+            OHContact *contact = [self _contactForCNContact:cnContact];
+            transformDuration += CFAbsoluteTimeGetCurrent() - transformStartTime;
+            [contacts addObject:contact];
+
+            if (isLoad && self.batchSize) {
+                [batch addObject:contact];
+                if (batch.count == self.batchSize) {
+                    self.onContactsDataProviderBatchLoadedSignal.fire(batch, self);
+                    batch = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:self.batchSize];
+                }
+            }
+        }];
 
+        if (cancelled) {
+            return;
+        }
         if (error) {
             failure(error);
             return;
         }
-
-        [cnContacts addObjectsFromArray:contactsInContainer];
     }
 
-    NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:cnContacts.count];
-    for (CNContact *cnContact in cnContacts) {
-        [contacts addObject:[self _contactForCNContact:cnContact]];
+    if (isLoad) {
+        if (batch.count) {
+            self.onContactsDataProviderBatchLoadedSignal.fire(batch, self);
+        }
+        _lastLoadTransformDuration = transformDuration;
     }
     success(contacts);
 }
 
+- (NSArray *)_keysToFetch
+{
+    NSMutableArray *keysToFetch = [NSMutableArray arrayWithObjects:[CNContactFormatter descriptorForRequiredKeysForStyle:CNContactFormatterStyleFullName],
+                                                                   CNContactEmailAddressesKey,
+                                                                   CNContactPhoneNumbersKey,
+                                                                   CNContactUrlAddressesKey,
+                                                                   CNContactPostalAddressesKey,
+                                                                   CNContactOrganizationNameKey,
+                                                                   CNContactJobTitleKey,
+                                                                   CNContactDepartmentNameKey,
+                                                                   nil];
+
+    if (self.loadThumbnailImage) {
+        [keysToFetch addObject:CNContactThumbnailImageDataKey];
+    }
+    return keysToFetch;
+}
+
 - (OHContact *)_contactForCNContact:(CNContact *)cnContact
 {
     OHContact *contact = [[OHContact alloc] init];
@@ -0,0 +1,94 @@
+//
+//  OHSyntheticContactsDataProvider.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "OHContactsDataProviderProtocol.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Data provider that generates a realistic address book from a seed, for load testing and benchmarks without a contact store
+ *
+ *  @discussion The same seed and configuration always produce the same contacts. Names are drawn from several locales, the number of phone
+ *  numbers, email addresses and postal addresses per contact follows the distribution seen in real address books, and some people appear
+ *  more than once with slightly different data, as they do when several accounts are synced. Loads can be delayed and made to fail to
+ *  simulate slow or unreliable stores.
+ */
+@interface OHSyntheticContactsDataProvider : NSObject <OHContactsDataProviderProtocol>
+
+extern NSString *_Nonnull kOHSyntheticContactsDataProviderContactIdentifierKey;    // Identifier unique among the generated contacts (NSString *)
+extern NSString *_Nonnull kOHSyntheticContactsDataProviderThumbnailDataKey;        // Bytes standing in for a thumbnail photo (NSData *)
+
+- (instancetype)initWithContactCount:(NSUInteger)contactCount seed:(uint64_t)seed NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Number of contacts generated by each load
+ */
+@property (nonatomic, readonly) NSUInteger contactCount;
+
+/**
+ *  Seed of the generated address book
+ */
+@property (nonatomic, readonly) uint64_t seed;
+
+/**
+ *  Fraction of contacts that duplicate an earlier person, defaults to 0.05
+ */
+@property (nonatomic) double duplicateRate;
+
+/**
+ *  Fraction of contacts that have a thumbnail, defaults to 0.1
+ *
+ *  @discussion Contacts with a thumbnail carry a few kilobytes of data under kOHSyntheticContactsDataProviderThumbnailDataKey, and on iOS
+ *  a small thumbnailPhoto as well.
+ */
+@property (nonatomic) double thumbnailRate;
+
+/**
+ *  Time between loadContacts and the first contact being available, defaults to 0
+ *
+ *  @discussion When latency and latencyJitter are both 0, loadContacts generates the contacts and finishes before returning. Otherwise the
+ *  contacts are generated on a background queue after the delay.
+ */
+@property (nonatomic) NSTimeInterval latency;
+
+/**
+ *  Maximum random time added to latency on each load, defaults to 0
+ */
+@property (nonatomic) NSTimeInterval latencyJitter;
+
+/**
+ *  Probability that a load fails with an OHContactsDataProviderErrorCodeUnknown error instead of finishing, defaults to 0
+ *
+ *  @discussion Failures are drawn from the seed, so the same sequence of loads fails at the same points on every run.
+ */
+@property (nonatomic) double errorRate;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,472 @@
+//
+//  OHSyntheticContactsDataProvider.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHSyntheticContactsDataProvider.h"
+
+#if TARGET_OS_IPHONE
+#import <UIKit/UIKit.h>
+#endif
+
+static NSString *const kOHSyntheticContactIdentifierPrefix = @"synthetic-";
+
+/**
+ *  Salt of the random stream that decides the outcome of each load, so it does not depend on the contacts
+ */
+static const uint64_t kOHSyntheticLoadSalt = 0x6c6f6164ULL;
+
+/**
+ *  splitmix64, used to derive an independent random stream for each contact so any contact can be generated on its own
+ */
+static uint64_t OHSyntheticRandomSeed(uint64_t seed, uint64_t index)
+{
+    uint64_t z = seed + (index + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return (z ^ (z >> 31)) ?: 1;
+}
+
+/**
+ *  xorshift64*
+ */
+static uint64_t OHSyntheticRandomNext(uint64_t *state)
+{
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545f4914f6cdd1dULL;
+}
+
+static double OHSyntheticRandomUnit(uint64_t *state)
+{
+    return (double)(OHSyntheticRandomNext(state) >> 11) * 0x1.0p-53;
+}
+
+static NSUInteger OHSyntheticRandomIndex(uint64_t *state, NSUInteger count)
+{
+    return count ? (NSUInteger)(OHSyntheticRandomNext(state) % count) : 0;
+}
+
+/**
+ *  Picks an index with probability proportional to its weight
+ */
+static NSUInteger OHSyntheticRandomWeightedIndex(uint64_t *state, const double *weights, NSUInteger count)
+{
+    double total = 0;
+    for (NSUInteger i = 0; i < count; i++) {
+        total += weights[i];
+    }
+    double target = OHSyntheticRandomUnit(state) * total;
+    for (NSUInteger i = 0; i < count; i++) {
+        target -= weights[i];
+        if (target < 0) {
+            return i;
+        }
+    }
+    return count - 1;
+}
+
+// Number of phone numbers, email addresses and postal addresses per contact, indexed by count
+static const double kOHSyntheticPhoneNumberCountWeights[] = { 0.10, 0.55, 0.25, 0.07, 0.03 };
+static const double kOHSyntheticEmailAddressCountWeights[] = { 0.45, 0.40, 0.12, 0.03 };
+static const double kOHSyntheticPostalAddressCountWeights[] = { 0.80, 0.17, 0.03 };
+
+// Share of each locale among the generated people, in the order of the locales returned by _locales
+static const double kOHSyntheticLocaleWeights[] = { 0.50, 0.12, 0.06, 0.06, 0.08, 0.05, 0.06, 0.04, 0.03 };
+
+@interface OHSyntheticContactsDataProvider ()
+
+@property (nonatomic) NSUInteger loadCount;
+
+/**
+ *  Incremented by cancelLoading, a load stops when it no longer matches the value it started with
+ */
+@property (atomic) NSUInteger loadGeneration;
+
+@end
+
+@implementation OHSyntheticContactsDataProvider
+
+@synthesize onContactsDataProviderFinishedLoadingSignal = _onContactsDataProviderFinishedLoadingSignal, onContactsDataProviderErrorSignal = _onContactsDataProviderErrorSignal, status = _status, contacts = _contacts, onContactsDataProviderBatchLoadedSignal = _onContactsDataProviderBatchLoadedSignal, batchSize = _batchSize, lastLoadTransformDuration = _lastLoadTransformDuration;
+
+const NSString *kOHSyntheticContactsDataProviderContactIdentifierKey = @"kOHSyntheticContactsDataProviderContactIdentifierKey";
+const NSString *kOHSyntheticContactsDataProviderThumbnailDataKey = @"kOHSyntheticContactsDataProviderThumbnailDataKey";
+
+- (instancetype)initWithContactCount:(NSUInteger)contactCount seed:(uint64_t)seed
+{
+    if (self = [super init]) {
+        _contactCount = contactCount;
+        _seed = seed;
+        _duplicateRate = 0.05;
+        _thumbnailRate = 0.1;
+        _onContactsDataProviderFinishedLoadingSignal = [[OHContactsDataProviderFinishedLoadingSignal alloc] init];
+        _onContactsDataProviderErrorSignal = [[OHContactsDataProviderErrorSignal alloc] init];
+        _onContactsDataProviderBatchLoadedSignal = [[OHContactsDataProviderBatchLoadedSignal alloc] init];
+        _status = OHContactsDataProviderStatusInitialized;
+    }
+    return self;
+}
+
+#pragma mark - OHContactsDataProviderProtocol
+
+- (void)loadContacts
+{
+    _status = OHContactsDataProviderStatusProcessing;
+
+    uint64_t loadState = OHSyntheticRandomSeed(self.seed ^ kOHSyntheticLoadSalt, self.loadCount++);
+    // A failing load stops part of the way through, after some batches may have been fired
+    NSUInteger failureIndex = OHSyntheticRandomUnit(&loadState) < self.errorRate ? OHSyntheticRandomIndex(&loadState, self.contactCount + 1) : NSNotFound;
+    NSTimeInterval delay = self.latency + self.latencyJitter * OHSyntheticRandomUnit(&loadState);
+    NSUInteger loadGeneration = self.loadGeneration;
+
+    if (delay <= 0) {
+        [self _generateContactsFailingAtIndex:failureIndex loadGeneration:loadGeneration];
+    } else {
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            [self _generateContactsFailingAtIndex:failureIndex loadGeneration:loadGeneration];
+        });
+    }
+}
+
+- (void)cancelLoading
+{
+    if (_status == OHContactsDataProviderStatusProcessing) {
+        self.loadGeneration++;
+        _status = OHContactsDataProviderStatusInitialized;
+    }
+}
+
++ (NSString *)providerIdentifier
+{
+    return NSStringFromClass([self class]);
+}
+
+- (NSString *)contactIdentifierForContact:(OHContact *)contact
+{
+    return [contact.customProperties objectForKey:kOHSyntheticContactsDataProviderContactIdentifierKey];
+}
+
+- (NSOrderedSet<OHContact *> *)fetchContactsWithIdentifiers:(NSSet<NSString *> *)contactIdentifiers error:(NSError **)error
+{
+    if (!contactIdentifiers) {
+        NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:self.contactCount];
+        for (NSUInteger i = 0; i < self.contactCount; i++) {
+            [contacts addObject:[self _contactAtIndex:i]];
+        }
+        return contacts;
+    }
+
+    NSMutableIndexSet *indexes = [[NSMutableIndexSet alloc] init];
+    for (NSString *contactIdentifier in contactIdentifiers) {
+        if ([contactIdentifier hasPrefix:kOHSyntheticContactIdentifierPrefix]) {
+            NSInteger index = [contactIdentifier substringFromIndex:kOHSyntheticContactIdentifierPrefix.length].integerValue;
+            if (index >= 0 && (NSUInteger)index < self.contactCount) {
+                [indexes addIndex:(NSUInteger)index];
+            }
+        }
+    }
+    NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:indexes.count];
+    [indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+        [contacts addObject:[self _contactAtIndex:index]];
+    }];
+    return contacts;
+}
+
+#pragma mark - Private
+
+- (void)_generateContactsFailingAtIndex:(NSUInteger)failureIndex loadGeneration:(NSUInteger)loadGeneration
+{
+    NSTimeInterval transformDuration = 0;
+    NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:self.contactCount];
+    NSMutableOrderedSet<OHContact *> *batch = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:self.batchSize];
+    for (NSUInteger i = 0; i < self.contactCount; i++) {
+        if (loadGeneration != self.loadGeneration) {
+            return;
+        }
+        if (i == failureIndex) {
+            break;
+        }
+
+        CFAbsoluteTime transformStartTime = CFAbsoluteTimeGetCurrent();
+        OHContact *contact = [self _contactAtIndex:i];
+        transformDuration += CFAbsoluteTimeGetCurrent() - transformStartTime;
+        [contacts addObject:contact];
+
+        if (self.batchSize) {
+            [batch addObject:contact];
+            if (batch.count == self.batchSize) {
+                self.onContactsDataProviderBatchLoadedSignal.fire(batch, self);
+                batch = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:self.batchSize];
+            }
+        }
+    }
+    _lastLoadTransformDuration = transformDuration;
+
+    if (loadGeneration != self.loadGeneration) {
+        return;
+    }
+    if (failureIndex != NSNotFound) {
+        _status = OHContactsDataProviderStatusError;
+        self.onContactsDataProviderErrorSignal.fire([NSError errorWithDomain:OHContactsDataProviderErrorDomain code:OHContactsDataProviderErrorCodeUnknown userInfo:nil], self);
+        return;
+    }
+
+    if (batch.count) {
+        self.onContactsDataProviderBatchLoadedSignal.fire(batch, self);
+    }
+    _contacts = contacts;
+    _status = OHContactsDataProviderStatusLoaded;
+    self.onContactsDataProviderFinishedLoadingSignal.fire(self);
+}
+
+- (OHContact *)_contactAtIndex:(NSUInteger)index
+{
+    uint64_t state = OHSyntheticRandomSeed(self.seed, index);
+    OHContact *contact;
+    if (index > 0 && OHSyntheticRandomUnit(&state) < self.duplicateRate) {
+        contact = [self _duplicateOfPersonAtIndex:OHSyntheticRandomIndex(&state, index) randomState:&state];
+    } else {
+        contact = [self _personWithRandomState:&state];
+    }
+
+    if (OHSyntheticRandomUnit(&state) < self.thumbnailRate) {
+        [contact.customProperties setObject:[self _thumbnailDataWithRandomState:&state] forKey:kOHSyntheticContactsDataProviderThumbnailDataKey];
+#if TARGET_OS_IPHONE
+        contact.thumbnailPhoto = [self _thumbnailPhotoWithRandomState:&state];
+#endif
+    }
+
+    [contact.customProperties setObject:[NSString stringWithFormat:@"%@%lu", kOHSyntheticContactIdentifierPrefix, (unsigned long)index] forKey:kOHSyntheticContactsDataProviderContactIdentifierKey];
+    return contact;
+}
+
+/**
+ *  The same person as another contact as a second account would have synced it: same names and main phone number, other details differ
+ */
+- (OHContact *)_duplicateOfPersonAtIndex:(NSUInteger)index randomState:(uint64_t *)state
+{
+    uint64_t personState = OHSyntheticRandomSeed(self.seed, index);
+    // Skip the draw that decides whether the other contact is itself a duplicate
+    OHSyntheticRandomUnit(&personState);
+    OHContact *person = [self _personWithRandomState:&personState];
+
+    OHContact *contact = [[OHContact alloc] init];
+    contact.firstName = person.firstName;
+    contact.lastName = person.lastName;
+    contact.fullName = person.fullName;
+
+    NSMutableOrderedSet<OHContactField *> *contactFields = [[NSMutableOrderedSet<OHContactField *> alloc] init];
+    for (OHContactField *contactField in person.contactFields) {
+        if (contactField.type == OHContactFieldTypePhoneNumber) {
+            [contactFields addObject:[[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:@"mobile" value:contactField.value dataProviderIdentifier:contactField.dataProviderIdentifier]];
+            break;
+        }
+    }
+    if (OHSyntheticRandomUnit(state) < 0.5) {
+        [contactFields addObject:[self _emailAddressFieldForContact:contact label:@"work" randomState:state]];
+    }
+    contact.contactFields = contactFields;
+    return contact;
+}
+
+- (OHContact *)_personWithRandomState:(uint64_t *)state
+{
+    NSArray<NSDictionary<NSString *, id> *> *locales = [[self class] _locales];
+    NSDictionary<NSString *, id> *locale = [locales objectAtIndex:OHSyntheticRandomWeightedIndex(state, kOHSyntheticLocaleWeights, locales.count)];
+
+    OHContact *contact = [[OHContact alloc] init];
+    NSArray<NSString *> *firstNames = [locale objectForKey:@"firstNames"];
+    NSArray<NSString *> *lastNames = [locale objectForKey:@"lastNames"];
+    contact.firstName = [firstNames objectAtIndex:OHSyntheticRandomIndex(state, firstNames.count)];
+    contact.lastName = [lastNames objectAtIndex:OHSyntheticRandomIndex(state, lastNames.count)];
+    if ([[locale objectForKey:@"familyNameFirst"] boolValue]) {
+        contact.fullName = [contact.lastName stringByAppendingString:contact.firstName];
+    } else {
+        contact.fullName = [NSString stringWithFormat:@"%@ %@", contact.firstName, contact.lastName];
+    }
+
+    if (OHSyntheticRandomUnit(state) < 0.3) {
+        NSArray<NSString *> *organizationNames = @[@"Uber", @"Acme Corporation", @"Globex", @"Initech", @"Umbrella", @"Stark Industries", @"Hooli", @"Pied Piper"];
+        contact.organizationName = [organizationNames objectAtIndex:OHSyntheticRandomIndex(state, organizationNames.count)];
+        if (OHSyntheticRandomUnit(state) < 0.5) {
+            NSArray<NSString *> *jobTitles = @[@"Engineer", @"Designer", @"Product Manager", @"Director", @"Sales Associate", @"Recruiter"];
+            contact.jobTitle = [jobTitles objectAtIndex:OHSyntheticRandomIndex(state, jobTitles.count)];
+        }
+    }
+
+    NSMutableOrderedSet<OHContactField *> *contactFields = [[NSMutableOrderedSet<OHContactField *> alloc] init];
+    NSArray<NSString *> *phoneNumberLabels = @[@"mobile", @"iPhone", @"home", @"work", @"main"];
+    static const double phoneNumberLabelWeights[] = { 0.50, 0.15, 0.15, 0.15, 0.05 };
+    NSUInteger phoneNumberCount = OHSyntheticRandomWeightedIndex(state, kOHSyntheticPhoneNumberCountWeights, sizeof(kOHSyntheticPhoneNumberCountWeights) / sizeof(double));
+    for (NSUInteger i = 0; i < phoneNumberCount; i++) {
+        NSString *label = [phoneNumberLabels objectAtIndex:OHSyntheticRandomWeightedIndex(state, phoneNumberLabelWeights, phoneNumberLabels.count)];
+        NSString *phoneNumber = [self _stringFromPattern:[locale objectForKey:@"phoneNumberPattern"] randomState:state];
+        [contactFields addObject:[[OHContactField alloc] initWithType:OHContactFieldTypePhoneNumber label:label value:phoneNumber dataProviderIdentifier:[[self class] providerIdentifier]]];
+    }
+
+    NSArray<NSString *> *emailAddressLabels = @[@"home", @"work", @"iCloud", @"other"];
+    NSUInteger emailAddressCount = OHSyntheticRandomWeightedIndex(state, kOHSyntheticEmailAddressCountWeights, sizeof(kOHSyntheticEmailAddressCountWeights) / sizeof(double));
+    for (NSUInteger i = 0; i < emailAddressCount; i++) {
+        NSString *label = [emailAddressLabels objectAtIndex:OHSyntheticRandomIndex(state, emailAddressLabels.count)];
+        [contactFields addObject:[self _emailAddressFieldForContact:contact label:label randomState:state]];
+    }
+    contact.contactFields = contactFields;
+
+    NSUInteger postalAddressCount = OHSyntheticRandomWeightedIndex(state, kOHSyntheticPostalAddressCountWeights, sizeof(kOHSyntheticPostalAddressCountWeights) / sizeof(double));
+    if (postalAddressCount) {
+        NSArray<NSString *> *cities = [locale objectForKey:@"cities"];
+        NSArray<NSString *> *streets = [locale objectForKey:@"streets"];
+        NSMutableOrderedSet<OHContactAddress *> *postalAddresses = [[NSMutableOrderedSet<OHContactAddress *> alloc] initWithCapacity:postalAddressCount];
+        for (NSUInteger i = 0; i < postalAddressCount; i++) {
+            NSString *street = [NSString stringWithFormat:@"%lu %@", (unsigned long)(1 + OHSyntheticRandomIndex(state, 2000)), [streets objectAtIndex:OHSyntheticRandomIndex(state, streets.count)]];
+            NSString *postalCode = [self _stringFromPattern:@"#####" randomState:state];
+            [postalAddresses addObject:[[OHContactAddress alloc] initWithLabel:(i == 0 ? @"home" : @"work") street:street city:[cities objectAtIndex:OHSyntheticRandomIndex(state, cities.count)] state:@"" postalCode:postalCode country:[locale objectForKey:@"country"] dataProviderIdentifier:[[self class] providerIdentifier]]];
+        }
+        contact.postalAddresses = postalAddresses;
+    }
+
+    return contact;
+}
+
+- (OHContactField *)_emailAddressFieldForContact:(OHContact *)contact label:(NSString *)label randomState:(uint64_t *)state
+{
+    NSArray<NSString *> *domains = @[@"gmail.com", @"yahoo.com", @"outlook.com", @"icloud.com", @"example.org"];
+    // Names in non-Latin scripts do not survive the lossy ASCII conversion, so those people get a generic mailbox name
+    NSString *name = [[NSString alloc] initWithData:[[NSString stringWithFormat:@"%@.%@", contact.firstName, contact.lastName].lowercaseString dataUsingEncoding:NSASCIIStringEncoding allowLossyConversion:YES] encoding:NSASCIIStringEncoding];
+    if (!name.length || [name rangeOfString:@"?"].location != NSNotFound) {
+        name = @"user";
+    }
+    NSString *emailAddress = [NSString stringWithFormat:@"%@%lu@%@", [name stringByReplacingOccurrencesOfString:@"'" withString:@""], (unsigned long)OHSyntheticRandomIndex(state, 1000), [domains objectAtIndex:OHSyntheticRandomIndex(state, domains.count)]];
+    return [[OHContactField alloc] initWithType:OHContactFieldTypeEmailAddress label:label value:emailAddress dataProviderIdentifier:[[self class] providerIdentifier]];
+}
+
+/**
+ *  Replaces each # in the pattern with a random digit
+ */
+- (NSString *)_stringFromPattern:(NSString *)pattern randomState:(uint64_t *)state
+{
+    NSUInteger length = pattern.length;
+    unichar characters[length];
+    [pattern getCharacters:characters range:NSMakeRange(0, length)];
+    for (NSUInteger i = 0; i < length; i++) {
+        if (characters[i] == '#') {
+            characters[i] = (unichar)('0' + OHSyntheticRandomIndex(state, 10));
+        }
+    }
+    return [NSString stringWithCharacters:characters length:length];
+}
+
+- (NSData *)_thumbnailDataWithRandomState:(uint64_t *)state
+{
+    NSUInteger length = 1024 + OHSyntheticRandomIndex(state, 3072);
+    NSMutableData *data = [[NSMutableData alloc] initWithLength:length];
+    uint8_t *bytes = data.mutableBytes;
+    for (NSUInteger i = 0; i < length; i += sizeof(uint64_t)) {
+        uint64_t value = OHSyntheticRandomNext(state);
+        memcpy(bytes + i, &value, MIN(sizeof(uint64_t), length - i));
+    }
+    return data;
+}
+
+#if TARGET_OS_IPHONE
+- (UIImage *)_thumbnailPhotoWithRandomState:(uint64_t *)state
+{
+    CGRect rect = CGRectMake(0, 0, 8, 8);
+    UIGraphicsBeginImageContextWithOptions(rect.size, YES, 1);
+    [[UIColor colorWithRed:OHSyntheticRandomUnit(state) green:OHSyntheticRandomUnit(state) blue:OHSyntheticRandomUnit(state) alpha:1] setFill];
+    UIRectFill(rect);
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    return image;
+}
+#endif
+
++ (NSArray<NSDictionary<NSString *, id> *> *)_locales
+{
+    static NSArray<NSDictionary<NSString *, id> *> *locales;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        locales = @[@{@"firstNames": @[@"James", @"Mary", @"John", @"Patricia", @"Robert", @"Jennifer", @"Michael", @"Linda", @"William", @"Elizabeth", @"David", @"Susan"],
+                      @"lastNames": @[@"Smith", @"Johnson", @"Williams", @"Brown", @"Jones", @"Miller", @"Davis", @"Wilson", @"Anderson", @"Taylor", @"O'Brien"],
+                      @"phoneNumberPattern": @"(4##) 5##-####",
+                      @"cities": @[@"San Francisco", @"New York", @"Chicago", @"Seattle", @"Austin"],
+                      @"streets": @[@"Market St", @"Broadway", @"Main St", @"Pine St"],
+                      @"country": @"US"},
+                    @{@"firstNames": @[@"José", @"María", @"Lucía", @"Javier", @"Carmen", @"Álvaro", @"Sofía", @"Andrés"],
+                      @"lastNames": @[@"García", @"Martínez", @"López", @"Sánchez", @"Pérez", @"Núñez", @"Gómez"],
+                      @"phoneNumberPattern": @"+34 6## ## ## ##",
+                      @"cities": @[@"Madrid", @"Barcelona", @"Sevilla", @"Valencia"],
+                      @"streets": @[@"Calle Mayor", @"Gran Vía", @"Calle de Alcalá"],
+                      @"country": @"ES"},
+                    @{@"firstNames": @[@"Jürgen", @"Lena", @"Lukas", @"Anna", @"Jörg", @"Sophie", @"Maximilian"],
+                      @"lastNames": @[@"Müller", @"Schmidt", @"Schneider", @"Fischer", @"Weiß", @"Schäfer"],
+                      @"phoneNumberPattern": @"+49 151 ########",
+                      @"cities": @[@"Berlin", @"München", @"Hamburg", @"Köln"],
+                      @"streets": @[@"Hauptstraße", @"Schillerstraße", @"Bahnhofstraße"],
+                      @"country": @"DE"},
+                    @{@"firstNames": @[@"François", @"Chloé", @"Hélène", @"Léo", @"Camille", @"Étienne", @"Zoë"],
+                      @"lastNames": @[@"Martin", @"Bernard", @"Dubois", @"Lefèvre", @"Moreau", @"Girard"],
+                      @"phoneNumberPattern": @"+33 6 ## ## ## ##",
+                      @"cities": @[@"Paris", @"Lyon", @"Marseille", @"Toulouse"],
+                      @"streets": @[@"Rue de Rivoli", @"Rue du Bac", @"Avenue Foch"],
+                      @"country": @"FR"},
+                    @{@"firstNames": @[@"伟", @"芳", @"娜", @"敏", @"静", @"磊", @"洋"],
+                      @"lastNames": @[@"王", @"李", @"张", @"刘", @"陈", @"杨"],
+                      @"familyNameFirst": @YES,
+                      @"phoneNumberPattern": @"+86 138 #### ####",
+                      @"cities": @[@"北京", @"上海", @"深圳", @"广州"],
+                      @"streets": @[@"长安街", @"南京路", @"人民路"],
+                      @"country": @"CN"},
+                    @{@"firstNames": @[@"翔太", @"陽菜", @"蓮", @"結衣", @"大翔", @"さくら"],
+                      @"lastNames": @[@"佐藤", @"鈴木", @"高橋", @"田中", @"渡辺"],
+                      @"familyNameFirst": @YES,
+                      @"phoneNumberPattern": @"+81 90-####-####",
+                      @"cities": @[@"東京", @"大阪", @"京都", @"横浜"],
+                      @"streets": @[@"銀座", @"本町", @"栄町"],
+                      @"country": @"JP"},
+                    @{@"firstNames": @[@"Aarav", @"Priya", @"Vihaan", @"Ananya", @"Arjun", @"Diya"],
+                      @"lastNames": @[@"Sharma", @"Patel", @"Singh", @"Kumar", @"Gupta", @"Reddy"],
+                      @"phoneNumberPattern": @"+91 98### #####",
+                      @"cities": @[@"Mumbai", @"Delhi", @"Bengaluru", @"Hyderabad"],
+                      @"streets": @[@"MG Road", @"Park Street", @"Linking Road"],
+                      @"country": @"IN"},
+                    @{@"firstNames": @[@"محمد", @"فاطمة", @"أحمد", @"مريم", @"علي"],
+                      @"lastNames": @[@"الهاشمي", @"المنصوري", @"الزعابي", @"الشامسي"],
+                      @"phoneNumberPattern": @"+971 50 ### ####",
+                      @"cities": @[@"دبي", @"أبوظبي", @"الشارقة"],
+                      @"streets": @[@"شارع الشيخ زايد", @"شارع الوصل"],
+                      @"country": @"AE"},
+                    @{@"firstNames": @[@"Александр", @"Анастасия", @"Дмитрий", @"Екатерина", @"Иван"],
+                      @"lastNames": @[@"Иванов", @"Смирнов", @"Кузнецов", @"Попов", @"Соколов"],
+                      @"phoneNumberPattern": @"+7 9## ###-##-##",
+                      @"cities": @[@"Москва", @"Санкт-Петербург", @"Казань"],
+                      @"streets": @[@"Тверская улица", @"Невский проспект"],
+                      @"country": @"RU"}];
+    });
+    return locales;
+}
+
+@end
@@ -23,14 +23,20 @@
 //  THE SOFTWARE.
 //
 
+// Change Sources
+#import <Ohana/OHABAddressBookChangeSource.h>
+#import <Ohana/OHCNContactStoreChangeSource.h>
+
 // Data Providers
 #import <Ohana/OHABAddressBookContactsDataProvider.h>
 #import <Ohana/OHCNContactsDataProvider.h>
+#import <Ohana/OHSyntheticContactsDataProvider.h>
 
 // Post Processors
 #import <Ohana/OHAlphabeticalSortPostProcessor.h>
 #import <Ohana/OHCompositeAndPostProcessor.h>
 #import <Ohana/OHCompositeOrPostProcessor.h>
+#import <Ohana/OHCompositePostProcessorFingerprint.h>
 #import <Ohana/OHCompositeXorPostProcessor.h>
 #import <Ohana/OHPhoneNumberFormattingPostProcessor.h>
 #import <Ohana/OHRequiredFieldPostProcessor.h>
@@ -25,11 +25,17 @@
 
 #import <Foundation/Foundation.h>
 
-#import "OHContactsPostProcessorProtocol.h"
+#import "OHContactsIndexVectorPostProcessorProtocol.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface OHCompositeAndPostProcessor : NSObject <OHContactsPostProcessorProtocol>
+/**
+ *  Keeps the contacts kept by every subprocessor, in the order of the first subprocessor's result
+ *
+ *  @discussion Each subprocessor receives every input contact. Evaluation stops, and processContacts: returns nil, as soon as a subprocessor
+ *  after the first keeps no contacts.
+ */
+@interface OHCompositeAndPostProcessor : NSObject <OHContactsIndexVectorPostProcessorProtocol>
 
 - (instancetype)initWithPostProcessors:(NSOrderedSet<id<OHContactsPostProcessorProtocol>> *)postProcessors NS_DESIGNATED_INITIALIZER;
 
@@ -25,6 +25,8 @@
 
 #import "OHCompositeAndPostProcessor.h"
 
+#import "OHCompositePostProcessorFingerprint.h"
+
 @interface OHCompositeAndPostProcessor ()
 
 @property (nonatomic) NSOrderedSet<id<OHContactsPostProcessorProtocol>> *postProcessors;
@@ -41,29 +43,52 @@
     return self;
 }
 
-#pragma mark - OHContactsPostProcessorProtocol
+#pragma mark - OHContactsIndexVectorPostProcessorProtocol
 
 - (NSOrderedSet<OHContact *> *)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts
 {
-    NSMutableOrderedSet<OHContact *> *processedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
+    BOOL emptiedBySubprocessor = NO;
+    OHContactsIndexVector *processedIndexVector = [self _processIndexVector:[[OHContactsIndexVector alloc] initWithContacts:preProcessedContacts] emptiedBySubprocessor:&emptiedBySubprocessor];
+    return emptiedBySubprocessor ? nil : [processedIndexVector contacts];
+}
 
-    NSOrderedSet<OHContact *> *firstPostProcessorResults = [[self.postProcessors objectAtIndex:0] processContacts:preProcessedContacts];
-    if (firstPostProcessorResults.count) {
-        [processedContacts unionOrderedSet:firstPostProcessorResults];
-    }
+- (OHContactsIndexVector *)processIndexVector:(OHContactsIndexVector *)indexVector
+{
+    return [self _processIndexVector:indexVector emptiedBySubprocessor:NULL];
+}
 
-    if (self.postProcessors.count > 1) {
-        for (id<OHContactsPostProcessorProtocol> postProcessor in [[self.postProcessors array] subarrayWithRange:NSMakeRange(1, self.postProcessors.count - 1)]) {
-            NSOrderedSet<OHContact *> *subprocessedContacts = [postProcessor processContacts:preProcessedContacts];
-            if (subprocessedContacts.count) {
-                [processedContacts intersectOrderedSet:subprocessedContacts];
-            } else {
-                processedContacts = nil;
-                break;
+- (NSString *)configurationFingerprint
+{
+    return OHCompositePostProcessorFingerprint(self, self.postProcessors);
+}
+
+#pragma mark - Private
+
+/**
+ *  Runs every subprocessor on the whole input and intersects their results, stopping when a subprocessor after the first keeps no contacts
+ *  and setting emptiedBySubprocessor in that case
+ */
+- (OHContactsIndexVector *)_processIndexVector:(OHContactsIndexVector *)indexVector emptiedBySubprocessor:(BOOL *)emptiedBySubprocessor
+{
+    OHContactsIndexVector *processedIndexVector = [indexVector indexVectorProcessedByPostProcessor:[self.postProcessors objectAtIndex:0]];
+    for (NSUInteger i = 1; i < self.postProcessors.count; i++) {
+        OHContactsIndexVector *subprocessedIndexVector = [indexVector indexVectorProcessedByPostProcessor:[self.postProcessors objectAtIndex:i]];
+        if (!subprocessedIndexVector.count) {
+            if (emptiedBySubprocessor) {
+                *emptiedBySubprocessor = YES;
             }
+            return [indexVector indexVectorWithPositions:[NSData data]];
+        }
+        if ([processedIndexVector sharesBaseContactsWithIndexVectors:@[subprocessedIndexVector]]) {
+            processedIndexVector = [processedIndexVector indexVectorIntersectingIndexVector:subprocessedIndexVector];
+        } else {
+            // A subprocessor returned contacts that are not in the input, such as projections, so intersect the contacts themselves
+            NSMutableOrderedSet<OHContact *> *processedContacts = [[processedIndexVector contacts] mutableCopy];
+            [processedContacts intersectOrderedSet:[subprocessedIndexVector contacts]];
+            processedIndexVector = [[OHContactsIndexVector alloc] initWithContacts:processedContacts];
         }
     }
-    return processedContacts;
+    return processedIndexVector;
 }
 
 @end
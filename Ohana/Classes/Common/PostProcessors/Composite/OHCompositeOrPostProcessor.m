@@ -25,6 +25,8 @@
 
 #import "OHCompositeOrPostProcessor.h"
 
+#import "OHCompositePostProcessorFingerprint.h"
+
 @interface OHCompositeOrPostProcessor ()
 
 @property (nonatomic) NSOrderedSet<id<OHContactsPostProcessorProtocol>> *postProcessors;
@@ -41,18 +43,31 @@
     return self;
 }
 
-#pragma mark - OHContactsPostProcessorProtocol
+#pragma mark - OHContactsIndexVectorPostProcessorProtocol
 
 - (NSOrderedSet<OHContact *> *)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts
 {
-    NSMutableOrderedSet<OHContact *> *processedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
-    for (id<OHContactsPostProcessorProtocol> postProcessor in self.postProcessors) {
-        NSOrderedSet<OHContact *> *subprocessedContacts = [postProcessor processContacts:preProcessedContacts];
-        if (subprocessedContacts.count) {
-            [processedContacts unionOrderedSet:subprocessedContacts];
+    return [[self processIndexVector:[[OHContactsIndexVector alloc] initWithContacts:preProcessedContacts]] contacts];
+}
+
+- (OHContactsIndexVector *)processIndexVector:(OHContactsIndexVector *)indexVector
+{
+    NSArray<OHContactsIndexVector *> *subprocessedIndexVectors = [indexVector indexVectorsProcessedByPostProcessors:self.postProcessors.array concurrently:self.runsPostProcessorsConcurrently];
+    if (![indexVector sharesBaseContactsWithIndexVectors:subprocessedIndexVectors]) {
+        // A subprocessor returned contacts that are not in the input, such as projections, so combine the contacts themselves
+        NSMutableOrderedSet<OHContact *> *processedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
+        for (OHContactsIndexVector *subprocessedIndexVector in subprocessedIndexVectors) {
+            [processedContacts unionOrderedSet:[subprocessedIndexVector contacts]];
         }
+        return [[OHContactsIndexVector alloc] initWithContacts:processedContacts];
     }
-    return processedContacts;
+    OHContactsIndexVector *emptyIndexVector = [indexVector indexVectorWithPositions:[NSData data]];
+    return [emptyIndexVector indexVectorUnioningIndexVectors:subprocessedIndexVectors];
+}
+
+- (NSString *)configurationFingerprint
+{
+    return OHCompositePostProcessorFingerprint(self, self.postProcessors);
 }
 
 @end
@@ -0,0 +1,39 @@
+//
+//  OHCompositePostProcessorFingerprint.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHCompositePostProcessorFingerprint.h"
+
+NSString *OHCompositePostProcessorFingerprint(id<OHContactsPostProcessorProtocol> compositePostProcessor, NSOrderedSet<id<OHContactsPostProcessorProtocol>> *postProcessors)
+{
+    NSMutableArray<NSString *> *fingerprints = [[NSMutableArray alloc] initWithCapacity:postProcessors.count];
+    for (id<OHContactsPostProcessorProtocol> postProcessor in postProcessors) {
+        NSString *fingerprint = [postProcessor respondsToSelector:@selector(configurationFingerprint)] ? [postProcessor configurationFingerprint] : nil;
+        if (!fingerprint) {
+            return nil;
+        }
+        [fingerprints addObject:fingerprint];
+    }
+    return [NSString stringWithFormat:@"%@(%@)", NSStringFromClass([compositePostProcessor class]), [fingerprints componentsJoinedByString:@","]];
+}
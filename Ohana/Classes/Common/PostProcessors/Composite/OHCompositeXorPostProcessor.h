@@ -25,11 +25,23 @@
 
 #import <Foundation/Foundation.h>
 
-#import "OHContactsPostProcessorProtocol.h"
+#import "OHContactsIndexVectorPostProcessorProtocol.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface OHCompositeXorPostProcessor : NSObject <OHContactsPostProcessorProtocol>
+/**
+ *  Folds the results of the subprocessors with a symmetric difference, in order, stopping (and returning nil) once it is empty
+ *
+ *  @discussion Contacts returned by a subprocessor that were not in the input are dropped.
+ */
+@interface OHCompositeXorPostProcessor : NSObject <OHContactsIndexVectorPostProcessorProtocol>
+
+/**
+ *  Whether the subprocessors run at the same time on a concurrent queue
+ *
+ *  @discussion Defaults to NO. Only enable it if the subprocessors do not modify the contacts or share other mutable state.
+ */
+@property (nonatomic) BOOL runsPostProcessorsConcurrently;
 
 - (instancetype)initWithPostProcessors:(NSOrderedSet<id<OHContactsPostProcessorProtocol>> *)postProcessors NS_DESIGNATED_INITIALIZER;
 
@@ -25,6 +25,8 @@
 
 #import "OHCompositeXorPostProcessor.h"
 
+#import "OHCompositePostProcessorFingerprint.h"
+
 @interface OHCompositeXorPostProcessor ()
 
 @property (nonatomic) NSOrderedSet<id<OHContactsPostProcessorProtocol>> *postProcessors;
@@ -41,41 +43,60 @@
     return self;
 }
 
-#pragma mark - OHContactsPostProcessorProtocol
+#pragma mark - OHContactsIndexVectorPostProcessorProtocol
 
 - (NSOrderedSet<OHContact *> *)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts
 {
-    NSMutableOrderedSet<OHContact *> *processedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
+    OHContactsIndexVector *processedIndexVector = [self processIndexVector:[[OHContactsIndexVector alloc] initWithContacts:preProcessedContacts]];
+    return processedIndexVector.count ? [processedIndexVector contacts] : nil;
+}
 
-    NSOrderedSet<OHContact *> *firstPostProcessorResults = [[self.postProcessors objectAtIndex:0] processContacts:preProcessedContacts];
-    if (firstPostProcessorResults.count) {
-        [processedContacts unionOrderedSet:firstPostProcessorResults];
+- (OHContactsIndexVector *)processIndexVector:(OHContactsIndexVector *)indexVector
+{
+    NSArray<OHContactsIndexVector *> *subprocessedIndexVectors = [indexVector indexVectorsProcessedByPostProcessors:self.postProcessors.array concurrently:self.runsPostProcessorsConcurrently];
+    if (![indexVector sharesBaseContactsWithIndexVectors:subprocessedIndexVectors]) {
+        // A subprocessor returned contacts that are not in the input, such as projections, so combine the contacts themselves
+        return [[OHContactsIndexVector alloc] initWithContacts:[self _symmetricDifferenceOfIndexVectors:subprocessedIndexVectors]];
     }
+    OHContactsIndexVector *processedIndexVector = subprocessedIndexVectors.firstObject;
+    for (NSUInteger i = 1; i < subprocessedIndexVectors.count; i++) {
+        OHContactsIndexVector *subprocessedIndexVector = [subprocessedIndexVectors objectAtIndex:i];
+        if (!subprocessedIndexVector.count) {
+            continue;
+        }
+        processedIndexVector = [processedIndexVector indexVectorSymmetricDifferenceWithIndexVector:subprocessedIndexVector];
+        if (!processedIndexVector.count) {
+            break;
+        }
+    }
+    return processedIndexVector ?: [indexVector indexVectorWithPositions:[NSData data]];
+}
 
-    if (self.postProcessors.count > 1) {
-        for (id<OHContactsPostProcessorProtocol> postProcessor in [[self.postProcessors array] subarrayWithRange:NSMakeRange(1, self.postProcessors.count - 1)]) {
-            NSOrderedSet<OHContact *> *subprocessedContacts = [postProcessor processContacts:preProcessedContacts];
-
-            if (!subprocessedContacts.count) {
-                continue;
-            }
-
-            NSMutableOrderedSet<OHContact *> *unionContacts = [processedContacts mutableCopy];
-            [unionContacts unionOrderedSet:subprocessedContacts];
+- (NSString *)configurationFingerprint
+{
+    return OHCompositePostProcessorFingerprint(self, self.postProcessors);
+}
 
-            NSMutableOrderedSet<OHContact *> *intersectContacts = [processedContacts mutableCopy];
-            [intersectContacts intersectOrderedSet:subprocessedContacts];
+#pragma mark - Private
 
-            [unionContacts minusOrderedSet:intersectContacts];
+- (NSOrderedSet<OHContact *> *)_symmetricDifferenceOfIndexVectors:(NSArray<OHContactsIndexVector *> *)indexVectors
+{
+    NSMutableOrderedSet<OHContact *> *processedContacts = [[indexVectors.firstObject contacts] mutableCopy] ?: [[NSMutableOrderedSet<OHContact *> alloc] init];
+    for (NSUInteger i = 1; i < indexVectors.count; i++) {
+        NSOrderedSet<OHContact *> *subprocessedContacts = [[indexVectors objectAtIndex:i] contacts];
+        if (!subprocessedContacts.count) {
+            continue;
+        }
 
-            if (unionContacts.count) {
-                processedContacts = unionContacts;
-            } else {
-                processedContacts = nil;
-                break;
-            }
+        NSMutableOrderedSet<OHContact *> *intersectContacts = [processedContacts mutableCopy];
+        [intersectContacts intersectOrderedSet:subprocessedContacts];
+        [processedContacts unionOrderedSet:subprocessedContacts];
+        [processedContacts minusOrderedSet:intersectContacts];
+        if (!processedContacts.count) {
+            break;
         }
     }
     return processedContacts;
 }
+
 @end
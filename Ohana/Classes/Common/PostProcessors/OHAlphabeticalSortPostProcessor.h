@@ -25,7 +25,7 @@
 
 #import <Foundation/Foundation.h>
 
-#import "OHContactsPostProcessorProtocol.h"
+#import "OHContactsIndexVectorPostProcessorProtocol.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -35,13 +35,20 @@ typedef NS_ENUM(NSInteger, OHAlphabeticalSortPostProcessorSortMode) {
     OHAlphabeticalSortPostProcessorSortModeLastName
 };
 
-@interface OHAlphabeticalSortPostProcessor : NSObject <OHContactsPostProcessorProtocol>
+@interface OHAlphabeticalSortPostProcessor : NSObject <OHContactsIndexVectorPostProcessorProtocol>
 
 /**
  *  Mode by which to sort
  */
 @property (nonatomic, readonly) OHAlphabeticalSortPostProcessorSortMode sortMode;
 
+/**
+ *  Locale whose collation order is used to compare names
+ *
+ *  @discussion Defaults to nil, which uses the current locale at the time contacts are processed
+ */
+@property (nonatomic, nullable) NSLocale *locale;
+
 - (instancetype)initWithSortMode:(OHAlphabeticalSortPostProcessorSortMode)sortMode NS_DESIGNATED_INITIALIZER;
 
 - (instancetype)init NS_UNAVAILABLE;
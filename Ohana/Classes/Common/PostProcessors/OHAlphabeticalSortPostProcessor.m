@@ -25,6 +25,95 @@
 
 #import "OHAlphabeticalSortPostProcessor.h"
 
+/**
+ *  Sort key of one contact: the collation ranks of its primary and secondary names, and its index in the input vector as the tie breaker
+ */
+typedef struct {
+    uint32_t primaryRank;
+    uint32_t secondaryRank;
+    uint32_t index;
+} OHAlphabeticalSortKey;
+
+/**
+ *  Rank of a missing or empty name, which sorts after every name
+ */
+static const uint32_t kOHAlphabeticalSortMissingRank = UINT32_MAX;
+
+/**
+ *  Inputs smaller than this are sorted on the calling thread
+ */
+static const NSUInteger kOHAlphabeticalSortParallelThreshold = 4096;
+
+static int OHAlphabeticalSortKeyCompare(const void *key1, const void *key2)
+{
+    const OHAlphabeticalSortKey *sortKey1 = key1;
+    const OHAlphabeticalSortKey *sortKey2 = key2;
+    if (sortKey1->primaryRank != sortKey2->primaryRank) {
+        return sortKey1->primaryRank < sortKey2->primaryRank ? -1 : 1;
+    }
+    if (sortKey1->secondaryRank != sortKey2->secondaryRank) {
+        return sortKey1->secondaryRank < sortKey2->secondaryRank ? -1 : 1;
+    }
+    return sortKey1->index < sortKey2->index ? -1 : (sortKey1->index > sortKey2->index);
+}
+
+static void OHAlphabeticalSortKeysMerge(const OHAlphabeticalSortKey *left, NSUInteger leftCount, const OHAlphabeticalSortKey *right, NSUInteger rightCount, OHAlphabeticalSortKey *output)
+{
+    NSUInteger i = 0, j = 0, k = 0;
+    while (i < leftCount && j < rightCount) {
+        output[k++] = OHAlphabeticalSortKeyCompare(&right[j], &left[i]) < 0 ? right[j++] : left[i++];
+    }
+    while (i < leftCount) {
+        output[k++] = left[i++];
+    }
+    while (j < rightCount) {
+        output[k++] = right[j++];
+    }
+}
+
+/**
+ *  Sorts the keys with a merge sort whose runs are sorted, then merged pairwise, on a concurrent queue
+ *
+ *  @discussion Every key has a distinct index, so the keys are totally ordered and the result is the one a stable sort would give.
+ */
+static void OHAlphabeticalSortKeysSort(OHAlphabeticalSortKey *keys, NSUInteger count)
+{
+    if (count < kOHAlphabeticalSortParallelThreshold) {
+        qsort(keys, count, sizeof(OHAlphabeticalSortKey), OHAlphabeticalSortKeyCompare);
+        return;
+    }
+
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    NSUInteger runCount = MIN(MAX([NSProcessInfo processInfo].activeProcessorCount, 2), 16);
+    NSUInteger runLength = (count + runCount - 1) / runCount;
+    dispatch_apply(runCount, queue, ^(size_t run) {
+        NSUInteger start = run * runLength;
+        if (start < count) {
+            qsort(keys + start, MIN(runLength, count - start), sizeof(OHAlphabeticalSortKey), OHAlphabeticalSortKeyCompare);
+        }
+    });
+
+    OHAlphabeticalSortKey *buffer = malloc(count * sizeof(OHAlphabeticalSortKey));
+    OHAlphabeticalSortKey *source = keys;
+    OHAlphabeticalSortKey *destination = buffer;
+    for (NSUInteger width = runLength; width < count; width *= 2) {
+        const OHAlphabeticalSortKey *mergeSource = source;
+        OHAlphabeticalSortKey *mergeDestination = destination;
+        dispatch_apply((count + 2 * width - 1) / (2 * width), queue, ^(size_t pair) {
+            NSUInteger start = pair * 2 * width;
+            NSUInteger middle = MIN(start + width, count);
+            NSUInteger end = MIN(start + 2 * width, count);
+            OHAlphabeticalSortKeysMerge(mergeSource + start, middle - start, mergeSource + middle, end - middle, mergeDestination + start);
+        });
+        source = mergeDestination;
+        destination = (OHAlphabeticalSortKey *)mergeSource;
+    }
+    if (source != keys) {
+        memcpy(keys, source, count * sizeof(OHAlphabeticalSortKey));
+    }
+    free(buffer);
+}
+
 @interface OHAlphabeticalSortPostProcessor ()
 
 @property (nonatomic, readwrite) OHAlphabeticalSortPostProcessorSortMode sortMode;
@@ -41,33 +130,81 @@
     return self;
 }
 
-#pragma mark - OHContactsPostProcessorProtocol
+#pragma mark - OHContactsIndexVectorPostProcessorProtocol
 
 - (NSOrderedSet<OHContact *> *)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts
 {
-    NSOrderedSet<OHContact *> *processedContacts = [NSOrderedSet orderedSetWithArray:[preProcessedContacts sortedArrayUsingComparator:^NSComparisonResult(OHContact *contact1, OHContact *contact2) {
-        if (![self _comparableFieldForContact:contact1].length) {
-            return [self _comparableFieldForContact:contact2].length ? NSOrderedDescending : [self _secondaryComparisonOfContact:contact1 againstContact:contact2];
-        } else if (![self _comparableFieldForContact:contact2].length) {
-            return NSOrderedAscending;
-        }
-        NSComparisonResult comparison = [[self _comparableFieldForContact:contact1] compare:[self _comparableFieldForContact:contact2]];
-        if (comparison == NSOrderedSame) {
-            comparison = [self _secondaryComparisonOfContact:contact1 againstContact:contact2];
-        }
-        return comparison;
-    }]];
-    return processedContacts;
+    return [[self processIndexVector:[[OHContactsIndexVector alloc] initWithContacts:preProcessedContacts]] contacts];
+}
+
+- (OHContactsIndexVector *)processIndexVector:(OHContactsIndexVector *)indexVector
+{
+    NSUInteger count = indexVector.count;
+    const uint32_t *positions = indexVector.positions;
+    NSDictionary<NSString *, NSNumber *> *ranksByName = [self _collationRanksForNamesInIndexVector:indexVector];
+
+    // Each name is looked up once per contact, so the sort itself only compares integers
+    OHAlphabeticalSortKey *keys = malloc(MAX(count, 1) * sizeof(OHAlphabeticalSortKey));
+    for (NSUInteger i = 0; i < count; i++) {
+        OHContact *contact = [indexVector.baseContacts objectAtIndex:positions[i]];
+        NSString *primaryName = [self _comparableFieldForContact:contact];
+        NSString *secondaryName = [self _secondaryComparableFieldForContact:contact];
+        keys[i].primaryRank = primaryName.length ? [ranksByName objectForKey:primaryName].unsignedIntValue : kOHAlphabeticalSortMissingRank;
+        keys[i].secondaryRank = secondaryName.length ? [ranksByName objectForKey:secondaryName].unsignedIntValue : kOHAlphabeticalSortMissingRank;
+        keys[i].index = (uint32_t)i;
+    }
+    OHAlphabeticalSortKeysSort(keys, count);
+
+    NSMutableData *sortedPositions = [[NSMutableData alloc] initWithLength:count * sizeof(uint32_t)];
+    uint32_t *sortedBytes = sortedPositions.mutableBytes;
+    for (NSUInteger i = 0; i < count; i++) {
+        sortedBytes[i] = positions[keys[i].index];
+    }
+    free(keys);
+    return [indexVector indexVectorWithPositions:sortedPositions];
 }
 
-- (NSComparisonResult)_secondaryComparisonOfContact:(OHContact *)contact1 againstContact:(OHContact *)contact2
+- (NSString *)configurationFingerprint
 {
-    if (![self _secondaryComparableFieldForContact:contact1].length) {
-        return [self _secondaryComparableFieldForContact:contact2].length ? NSOrderedDescending : NSOrderedSame;
-    } else if (![self _secondaryComparableFieldForContact:contact2].length) {
-        return NSOrderedAscending;
+    return [NSString stringWithFormat:@"%@:%ld:%@", NSStringFromClass([self class]), (long)self.sortMode, (self.locale ?: [NSLocale currentLocale]).localeIdentifier];
+}
+
+#pragma mark - Private
+
+/**
+ *  Sorts the distinct names of the contacts with the locale's collation, and ranks them so that names that collate equally share a rank
+ */
+- (NSDictionary<NSString *, NSNumber *> *)_collationRanksForNamesInIndexVector:(OHContactsIndexVector *)indexVector
+{
+    NSMutableSet<NSString *> *names = [[NSMutableSet<NSString *> alloc] init];
+    for (NSUInteger i = 0; i < indexVector.count; i++) {
+        OHContact *contact = [indexVector contactAtIndex:i];
+        NSString *primaryName = [self _comparableFieldForContact:contact];
+        NSString *secondaryName = [self _secondaryComparableFieldForContact:contact];
+        if (primaryName.length) {
+            [names addObject:primaryName];
+        }
+        if (secondaryName.length) {
+            [names addObject:secondaryName];
+        }
+    }
+
+    NSLocale *locale = self.locale ?: [NSLocale currentLocale];
+    NSArray<NSString *> *sortedNames = [names.allObjects sortedArrayWithOptions:NSSortConcurrent usingComparator:^NSComparisonResult(NSString *name1, NSString *name2) {
+        return [name1 compare:name2 options:0 range:NSMakeRange(0, name1.length) locale:locale];
+    }];
+
+    NSMutableDictionary<NSString *, NSNumber *> *ranksByName = [[NSMutableDictionary<NSString *, NSNumber *> alloc] initWithCapacity:sortedNames.count];
+    uint32_t rank = 0;
+    NSString *previousName;
+    for (NSString *name in sortedNames) {
+        if (previousName && [previousName compare:name options:0 range:NSMakeRange(0, previousName.length) locale:locale] != NSOrderedSame) {
+            rank++;
+        }
+        [ranksByName setObject:@(rank) forKey:name];
+        previousName = name;
     }
-    return [[self _secondaryComparableFieldForContact:contact1] compare:[self _secondaryComparableFieldForContact:contact2]];
+    return ranksByName;
 }
 
 - (NSString *)_comparableFieldForContact:(OHContact *)contact
@@ -26,16 +26,16 @@
 #import <Foundation/Foundation.h>
 
 #import "OHContactsPostProcessorProtocol.h"
+#import "OHPhoneNumberService.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-typedef NS_OPTIONS (NSInteger, OHPhoneNumberFormat) {
-    OHPhoneNumberFormatE164             = 1 << 0,
-    OHPhoneNumberFormatInternational    = 1 << 1,
-    OHPhoneNumberFormatNational         = 1 << 2,
-    OHPhoneNumberFormatRFC3966          = 1 << 3,
-};
-
+/**
+ *  Writes formatted versions of each phone number field into its custom properties
+ *
+ *  @discussion Parsing and formatting go through the shared OHPhoneNumberService, whose metadata starts loading in the
+ *  background as soon as a post processor is created.
+ */
 @interface OHPhoneNumberFormattingPostProcessor : NSObject <OHContactsPostProcessorProtocol>
 
 extern NSString *_Nonnull kOHFormattedPhoneNumberE164;          // Phone number in E164 format (NSString *)
@@ -48,6 +48,16 @@ extern NSString *_Nonnull kOHFormattedPhoneNumberRFC3966;       // Phone number
  */
 @property (nonatomic) OHPhoneNumberFormat formats;
 
+/**
+ *  Whether phone numbers are formatted when they are first read rather than while processing, defaults to NO
+ *
+ *  @discussion When set, processing only registers a custom property provider for each format on the phone number
+ *  fields, and the formatted phone numbers must be read with -[OHContactField customPropertyForKey:] rather than from
+ *  customProperties. Each value is formatted once per contact field, on the thread that first reads it, so only the
+ *  fields that are actually displayed are formatted.
+ */
+@property (nonatomic) BOOL formatsOnDemand;
+
 - (instancetype)initWithFormats:(OHPhoneNumberFormat)formats;
 
 @end
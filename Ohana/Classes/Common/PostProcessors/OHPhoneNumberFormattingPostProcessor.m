@@ -25,19 +25,6 @@
 
 #import "OHPhoneNumberFormattingPostProcessor.h"
 
-// This imports libPhoneNumber-iOS if using libraries
-#if __has_include(<libPhoneNumber-iOS/NBPhoneNumberUtil.h>)
-#import <libPhoneNumber-iOS/NBPhoneNumberUtil.h>
-#elif __has_include(<libPhoneNumber_iOS/NBPhoneNumberUtil.h>)
-#import <libPhoneNumber_iOS/NBPhoneNumberUtil.h>
-#endif
-
-@interface OHPhoneNumberFormattingPostProcessor ()
-
-@property (nonatomic) NBPhoneNumberUtil *phoneNumberUtil;
-
-@end
-
 @implementation OHPhoneNumberFormattingPostProcessor
 
 const NSString *kOHFormattedPhoneNumberE164 = @"kOHFormattedPhoneNumberE164";
@@ -49,6 +36,7 @@ const NSString *kOHFormattedPhoneNumberRFC3966 = @"kOHFormattedPhoneNumberRFC396
 {
     if (self = [super init]) {
         _formats = formats;
+        [[OHPhoneNumberService sharedService] prewarmForRegion:[self _countryCode]];
     }
     return self;
 }
@@ -57,60 +45,72 @@ const NSString *kOHFormattedPhoneNumberRFC3966 = @"kOHFormattedPhoneNumberRFC396
 
 - (NSOrderedSet<OHContact *> *)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts
 {
+    OHPhoneNumberService *phoneNumberService = [OHPhoneNumberService sharedService];
+    NSString *countryCode = [self _countryCode];
+    if (self.formatsOnDemand) {
+        NSDictionary<NSString *, OHContactFieldCustomPropertyProvider> *customPropertyProviders = [self _customPropertyProvidersWithCountryCode:countryCode];
+        for (OHContact *contact in preProcessedContacts) {
+            for (OHContactField *contactField in contact.contactFields) {
+                if (contactField.type == OHContactFieldTypePhoneNumber) {
+                    contactField.customPropertyProviders = customPropertyProviders;
+                }
+            }
+        }
+        return preProcessedContacts;
+    }
     for (OHContact *contact in preProcessedContacts) {
         for (OHContactField *contactField in contact.contactFields) {
             if (contactField.type == OHContactFieldTypePhoneNumber) {
-                NSError *error;
-                NBPhoneNumber *phoneNumber = [self.phoneNumberUtil parse:contactField.value defaultRegion:[self _countryCode] error:&error];
-                if (!error) {
-                    if (self.formats & OHPhoneNumberFormatE164) {
-                        NSError *formattingError;
-                        NSString *formattedPhoneNumber = [self.phoneNumberUtil format:phoneNumber numberFormat:NBEPhoneNumberFormatE164 error:&formattingError];
-                        if (!formattingError) {
-                            [contactField.customProperties setObject:formattedPhoneNumber forKey:kOHFormattedPhoneNumberE164];
-                        }
-                    }
-                    if (self.formats & OHPhoneNumberFormatInternational) {
-                        NSError *formattingError;
-                        NSString *formattedPhoneNumber = [self.phoneNumberUtil format:phoneNumber numberFormat:NBEPhoneNumberFormatINTERNATIONAL error:&formattingError];
-                        if (!formattingError) {
-                            [contactField.customProperties setObject:formattedPhoneNumber forKey:kOHFormattedPhoneNumberInternational];
-                        }
-                    }
-                    if (self.formats & OHPhoneNumberFormatNational) {
-                        NSError *formattingError;
-                        NSString *formattedPhoneNumber = [self.phoneNumberUtil format:phoneNumber numberFormat:NBEPhoneNumberFormatNATIONAL error:&formattingError];
-                        if (!formattingError) {
-                            [contactField.customProperties setObject:formattedPhoneNumber forKey:kOHFormattedPhoneNumberNational];
-                        }
-                    }
-                    if (self.formats & OHPhoneNumberFormatRFC3966) {
-                        NSError *formattingError;
-                        NSString *formattedPhoneNumber = [self.phoneNumberUtil format:phoneNumber numberFormat:NBEPhoneNumberFormatRFC3966 error:&formattingError];
-                        if (!formattingError) {
-                            [contactField.customProperties setObject:formattedPhoneNumber forKey:kOHFormattedPhoneNumberRFC3966];
-                        }
-                    }
-                }
+                NSDictionary<NSNumber *, NSString *> *formattedPhoneNumbers = [phoneNumberService formattedPhoneNumbers:contactField.value formats:self.formats defaultRegion:countryCode];
+                [formattedPhoneNumbers enumerateKeysAndObjectsUsingBlock:^(NSNumber *format, NSString *formattedPhoneNumber, BOOL *stop) {
+                    [contactField.customProperties setObject:formattedPhoneNumber forKey:[OHPhoneNumberFormattingPostProcessor _customPropertyKeyForFormat:format.integerValue]];
+                }];
             }
         }
     }
     return preProcessedContacts;
 }
 
+- (NSString *)configurationFingerprint
+{
+    return [NSString stringWithFormat:@"%@:%ld:%d:%@", NSStringFromClass([self class]), (long)self.formats, self.formatsOnDemand, [self _countryCode]];
+}
+
 #pragma mark - Private
 
-- (NBPhoneNumberUtil *)phoneNumberUtil
+- (NSDictionary<NSString *, OHContactFieldCustomPropertyProvider> *)_customPropertyProvidersWithCountryCode:(NSString *)countryCode
+{
+    NSMutableDictionary<NSString *, OHContactFieldCustomPropertyProvider> *customPropertyProviders = [[NSMutableDictionary alloc] init];
+    for (NSNumber *format in @[@(OHPhoneNumberFormatE164), @(OHPhoneNumberFormatInternational), @(OHPhoneNumberFormatNational), @(OHPhoneNumberFormatRFC3966)]) {
+        if (self.formats & format.integerValue) {
+            OHPhoneNumberFormat phoneNumberFormat = format.integerValue;
+            OHContactFieldCustomPropertyProvider provider = ^id(OHContactField *contactField) {
+                return [[OHPhoneNumberService sharedService] formattedPhoneNumber:contactField.value format:phoneNumberFormat defaultRegion:countryCode];
+            };
+            [customPropertyProviders setObject:provider forKey:[OHPhoneNumberFormattingPostProcessor _customPropertyKeyForFormat:phoneNumberFormat]];
+        }
+    }
+    return customPropertyProviders;
+}
+
++ (NSString *)_customPropertyKeyForFormat:(OHPhoneNumberFormat)format
 {
-    if (!_phoneNumberUtil) {
-        _phoneNumberUtil = [[NBPhoneNumberUtil alloc] init];
+    switch (format) {
+        case OHPhoneNumberFormatInternational:
+            return (NSString *)kOHFormattedPhoneNumberInternational;
+        case OHPhoneNumberFormatNational:
+            return (NSString *)kOHFormattedPhoneNumberNational;
+        case OHPhoneNumberFormatRFC3966:
+            return (NSString *)kOHFormattedPhoneNumberRFC3966;
+        case OHPhoneNumberFormatE164:
+        default:
+            return (NSString *)kOHFormattedPhoneNumberE164;
     }
-    return _phoneNumberUtil;
 }
 
 - (NSString *)_countryCode
 {
-    return [[[NSLocale currentLocale] objectForKey:NSLocaleCountryCode] uppercaseString];
+    return [OHPhoneNumberService currentRegion];
 }
 
 @end
@@ -25,11 +25,11 @@
 
 #import <Foundation/Foundation.h>
 
-#import "OHContactsPostProcessorProtocol.h"
+#import "OHContactsIndexVectorPostProcessorProtocol.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface OHRequiredFieldPostProcessor : NSObject <OHContactsPostProcessorProtocol>
+@interface OHRequiredFieldPostProcessor : NSObject <OHContactsIndexVectorPostProcessorProtocol>
 
 /**
  *  Type of field that is required
@@ -41,20 +41,24 @@
     return self;
 }
 
-#pragma mark - OHContactsPostProcessorProtocol
+#pragma mark - OHContactsIndexVectorPostProcessorProtocol
 
 - (NSOrderedSet<OHContact *> *)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts
 {
-    NSMutableOrderedSet<OHContact *> *processedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
-    for (OHContact *preProcessedContact in preProcessedContacts) {
-        for (OHContactField *contactField in preProcessedContact.contactFields) {
-            if (contactField.type == self.fieldType) {
-                [processedContacts addObject:preProcessedContact];
-                break;
-            }
-        }
-    }
-    return processedContacts;
+    return [[self processIndexVector:[[OHContactsIndexVector alloc] initWithContacts:preProcessedContacts]] contacts];
+}
+
+- (OHContactsIndexVector *)processIndexVector:(OHContactsIndexVector *)indexVector
+{
+    OHContactFieldType fieldType = self.fieldType;
+    return [indexVector indexVectorPassingTest:^BOOL(OHContact *contact) {
+        return [contact hasContactFieldOfType:fieldType];
+    }];
+}
+
+- (NSString *)configurationFingerprint
+{
+    return [NSString stringWithFormat:@"%@:%ld", NSStringFromClass([self class]), (long)self.fieldType];
 }
 
 @end
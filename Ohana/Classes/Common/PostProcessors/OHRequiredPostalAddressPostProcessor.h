@@ -25,11 +25,11 @@
 
 #import <Foundation/Foundation.h>
 
-#import "OHContactsPostProcessorProtocol.h"
+#import "OHContactsIndexVectorPostProcessorProtocol.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface OHRequiredPostalAddressPostProcessor : NSObject <OHContactsPostProcessorProtocol>
+@interface OHRequiredPostalAddressPostProcessor : NSObject <OHContactsIndexVectorPostProcessorProtocol>
 
 @end
 
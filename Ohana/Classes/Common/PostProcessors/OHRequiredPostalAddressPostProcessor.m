@@ -27,17 +27,23 @@
 
 @implementation OHRequiredPostalAddressPostProcessor
 
-#pragma mark - OHContactsPostProcessorProtocol
+#pragma mark - OHContactsIndexVectorPostProcessorProtocol
 
 - (NSOrderedSet<OHContact *> *)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts
 {
-    NSMutableOrderedSet<OHContact *> *processedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
-    for (OHContact *preProcessedContact in preProcessedContacts) {
-        if (preProcessedContact.postalAddresses.count) {
-            [processedContacts addObject:preProcessedContact];
-        }
-    }
-    return processedContacts;
+    return [[self processIndexVector:[[OHContactsIndexVector alloc] initWithContacts:preProcessedContacts]] contacts];
+}
+
+- (OHContactsIndexVector *)processIndexVector:(OHContactsIndexVector *)indexVector
+{
+    return [indexVector indexVectorPassingTest:^BOOL(OHContact *contact) {
+        return contact.postalAddresses.count > 0;
+    }];
+}
+
+- (NSString *)configurationFingerprint
+{
+    return NSStringFromClass([self class]);
 }
 
 @end
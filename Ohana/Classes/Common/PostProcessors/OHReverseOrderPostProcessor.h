@@ -25,11 +25,11 @@
 
 #import <Foundation/Foundation.h>
 
-#import "OHContactsPostProcessorProtocol.h"
+#import "OHContactsIndexVectorPostProcessorProtocol.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface OHReverseOrderPostProcessor : NSObject <OHContactsPostProcessorProtocol>
+@interface OHReverseOrderPostProcessor : NSObject <OHContactsIndexVectorPostProcessorProtocol>
 
 @end
 
@@ -27,7 +27,7 @@
 
 @implementation OHReverseOrderPostProcessor
 
-#pragma mark - OHContactsPostProcessorProtocol
+#pragma mark - OHContactsIndexVectorPostProcessorProtocol
 
 - (NSOrderedSet<OHContact *> *)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts
 {
@@ -35,4 +35,14 @@
     return processedContacts;
 }
 
+- (OHContactsIndexVector *)processIndexVector:(OHContactsIndexVector *)indexVector
+{
+    return [indexVector reversedIndexVector];
+}
+
+- (NSString *)configurationFingerprint
+{
+    return NSStringFromClass([self class]);
+}
+
 @end
@@ -29,6 +29,12 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ *  Splits each contact into one contact per contact field of a type
+ *
+ *  @discussion The split contacts are OHContactProjection objects that share everything but their contact fields with the original
+ *  contact, instead of copies of it.
+ */
 @interface OHSplitOnFieldTypePostProcessor : NSObject <OHContactsPostProcessorProtocol>
 
 /**
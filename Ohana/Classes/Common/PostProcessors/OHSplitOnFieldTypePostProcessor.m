@@ -25,6 +25,8 @@
 
 #import "OHSplitOnFieldTypePostProcessor.h"
 
+#import "OHContactProjection.h"
+
 @interface OHSplitOnFieldTypePostProcessor ()
 
 @property (nonatomic, readwrite) OHContactFieldType fieldType;
@@ -47,15 +49,21 @@
 {
     NSMutableOrderedSet<OHContact *> *processedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
     for (OHContact *preProcessedContact in preProcessedContacts) {
+        if (![preProcessedContact hasContactFieldOfType:self.fieldType]) {
+            continue;
+        }
         for (OHContactField *contactField in preProcessedContact.contactFields) {
             if (contactField.type == self.fieldType) {
-                OHContact *splitContact = [preProcessedContact copy];
-                splitContact.contactFields = [NSOrderedSet orderedSetWithObject:contactField];
-                [processedContacts addObject:splitContact];
+                [processedContacts addObject:[[OHContactProjection alloc] initWithContact:preProcessedContact contactField:contactField]];
             }
         }
     }
     return processedContacts;
 }
 
+- (NSString *)configurationFingerprint
+{
+    return [NSString stringWithFormat:@"%@:%ld", NSStringFromClass([self class]), (long)self.fieldType];
+}
+
 @end
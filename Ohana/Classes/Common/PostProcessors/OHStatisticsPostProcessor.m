@@ -44,22 +44,16 @@ const NSString *kOHStatisticsHasMobilePhoneNumber = @"kOHStatisticsHasMobilePhon
     for (OHContact *contact in preProcessedContacts) {
         [contact.customProperties setObject:[NSNumber numberWithUnsignedInteger:contact.contactFields.count] forKey:kOHStatisticsNumberOfContactFields];
 
-        NSUInteger phoneNumberCount = 0;
-        NSUInteger emailAddressCount = 0;
+        NSUInteger phoneNumberCount = [contact numberOfContactFieldsOfType:OHContactFieldTypePhoneNumber];
+        NSUInteger emailAddressCount = [contact numberOfContactFieldsOfType:OHContactFieldTypeEmailAddress];
         BOOL hasMobileNumber = NO;
-        for (OHContactField *contactField in contact.contactFields) {
-            switch (contactField.type) {
-                case OHContactFieldTypePhoneNumber:
-                    phoneNumberCount++;
-                    if ([contactField.label isEqualToString:mobileLabel] || [contactField.label isEqualToString:iphoneLabel]) {
-                        hasMobileNumber = YES;
-                    }
-                    break;
-                case OHContactFieldTypeEmailAddress:
-                    emailAddressCount++;
-                    break;
-                default:
+        if (phoneNumberCount) {
+            // Only the labels still need a walk over the fields, and only for contacts with phone numbers
+            for (OHContactField *contactField in contact.contactFields) {
+                if (contactField.type == OHContactFieldTypePhoneNumber && ([contactField.label isEqualToString:mobileLabel] || [contactField.label isEqualToString:iphoneLabel])) {
+                    hasMobileNumber = YES;
                     break;
+                }
             }
         }
         [contact.customProperties setObject:[NSNumber numberWithUnsignedInteger:phoneNumberCount] forKey:kOHStatisticsNumberOfPhoneNumbers];
@@ -70,4 +64,9 @@ const NSString *kOHStatisticsHasMobilePhoneNumber = @"kOHStatisticsHasMobilePhon
     return preProcessedContacts;
 }
 
+- (NSString *)configurationFingerprint
+{
+    return NSStringFromClass([self class]);
+}
+
 @end
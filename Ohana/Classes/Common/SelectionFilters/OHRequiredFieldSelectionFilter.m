@@ -47,11 +47,8 @@
 {
     NSMutableOrderedSet *filteredContacts = [[NSMutableOrderedSet alloc] init];
     for (OHContact *contact in preFilteredContacts) {
-        for (OHContactField *field in contact.contactFields) {
-            if (field.type == self.fieldType) {
-                [filteredContacts addObject:contact];
-                break;
-            }
+        if ([contact hasContactFieldOfType:self.fieldType]) {
+            [filteredContacts addObject:contact];
         }
     }
     return filteredContacts;
@@ -23,7 +23,10 @@
 //	THE SOFTWARE.
 //
 
+#import <Foundation/Foundation.h>
+#if TARGET_OS_IPHONE
 #import <UIKit/UIKit.h>
+#endif
 
 #import "OHContactField.h"
 #import "OHContactAddress.h"
@@ -67,15 +70,37 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, copy) NSOrderedSet<OHContactField *> *contactFields;
 
+/**
+ *  Bit mask of the types of the contact's contact fields
+ *
+ *  @discussion Computed together with the per type counts whenever contactFields is set, so checking for a field type does not walk
+ *  the contact fields.
+ */
+@property (nonatomic, readonly) OHContactFieldTypeMask contactFieldTypes;
+
+/**
+ *  Returns whether the contact has at least one contact field of the type, in constant time
+ */
+- (BOOL)hasContactFieldOfType:(OHContactFieldType)type;
+
+/**
+ *  Returns the number of contact fields of the type, in constant time
+ */
+- (NSUInteger)numberOfContactFieldsOfType:(OHContactFieldType)type;
+
 /**
  *  Postal addresses associated with the contact
  */
 @property (nonatomic, nullable, copy) NSOrderedSet<OHContactAddress *> *postalAddresses;
 
+#if TARGET_OS_IPHONE
 /**
  *  Thumbnail photo
+ *
+ *  @discussion Not available when Ohana is built against Foundation only, for example for the benchmarks
  */
 @property (nonatomic, nullable, copy) UIImage *thumbnailPhoto;
+#endif
 
 /**
  *  Set of custom tags (may be added by data providers, post processors, etc.)
@@ -87,6 +112,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly) NSMutableDictionary<NSString *, id> *customProperties;
 
+/**
+ *  Fingerprint of the contact's names, contact fields, postal addresses and thumbnail photo
+ *
+ *  @discussion Computed on first access and recomputed after any of those properties is set. The thumbnail photo contributes the hash of its
+ *  raw pixel data. Tags and custom properties are not included since they can be mutated in place. The contact does not override isEqual:
+ *  and hash, so collections of contacts keep comparing contacts by identity.
+ */
+@property (nonatomic, readonly) OHContentFingerprint contentFingerprint;
+
 - (BOOL)isEqualToContact:(OHContact *)contact;
 
 @end
@@ -30,9 +30,118 @@
 @property (nonatomic, readwrite) NSMutableSet<NSString *> *tags;
 @property (nonatomic, readwrite) NSMutableDictionary<NSString *, id> *customProperties;
 
+/**
+ *  Lazily computed fingerprints, 0 until computed and reset by the setters of the properties they cover
+ */
+@property (nonatomic) OHContentFingerprint cachedContentFingerprint;
+@property (nonatomic) OHContentFingerprint cachedThumbnailFingerprint;
+
 @end
 
-@implementation OHContact
+@implementation OHContact {
+    /**
+     *  Number of contact fields of each type, kept in sync with contactFieldTypes by setContactFields:
+     */
+    uint32_t _contactFieldCounts[OHContactFieldTypeOther + 1];
+}
+
+#pragma mark - Properties
+
+- (void)setFullName:(NSString *)fullName
+{
+    _fullName = [fullName copy];
+    self.cachedContentFingerprint = 0;
+}
+
+- (void)setFirstName:(NSString *)firstName
+{
+    _firstName = [firstName copy];
+    self.cachedContentFingerprint = 0;
+}
+
+- (void)setLastName:(NSString *)lastName
+{
+    _lastName = [lastName copy];
+    self.cachedContentFingerprint = 0;
+}
+
+- (void)setOrganizationName:(NSString *)organizationName
+{
+    _organizationName = [organizationName copy];
+    self.cachedContentFingerprint = 0;
+}
+
+- (void)setJobTitle:(NSString *)jobTitle
+{
+    _jobTitle = [jobTitle copy];
+    self.cachedContentFingerprint = 0;
+}
+
+- (void)setDepartmentName:(NSString *)departmentName
+{
+    _departmentName = [departmentName copy];
+    self.cachedContentFingerprint = 0;
+}
+
+- (void)setContactFields:(NSOrderedSet<OHContactField *> *)contactFields
+{
+    _contactFields = [contactFields copy];
+    self.cachedContentFingerprint = 0;
+    [self _updateContactFieldTypes];
+}
+
+- (BOOL)hasContactFieldOfType:(OHContactFieldType)type
+{
+    return (self.contactFieldTypes & OHContactFieldTypeMaskForType(type)) != 0;
+}
+
+- (NSUInteger)numberOfContactFieldsOfType:(OHContactFieldType)type
+{
+    if (type < 0 || type > OHContactFieldTypeOther) {
+        return 0;
+    }
+    return _contactFieldCounts[type];
+}
+
+- (void)setPostalAddresses:(NSOrderedSet<OHContactAddress *> *)postalAddresses
+{
+    _postalAddresses = [postalAddresses copy];
+    self.cachedContentFingerprint = 0;
+}
+
+#if TARGET_OS_IPHONE
+- (void)setThumbnailPhoto:(UIImage *)thumbnailPhoto
+{
+    _thumbnailPhoto = [thumbnailPhoto copy];
+    self.cachedThumbnailFingerprint = 0;
+    self.cachedContentFingerprint = 0;
+}
+#endif
+
+- (OHContentFingerprint)contentFingerprint
+{
+    if (!self.cachedContentFingerprint) {
+        OHContentFingerprint fingerprint = OHContentFingerprintCombine(kOHContentFingerprintSeed, OHContentFingerprintOfString(self.fullName));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.firstName));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.lastName));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.organizationName));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.jobTitle));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.departmentName));
+        fingerprint = OHContentFingerprintCombine(fingerprint, (OHContentFingerprint)self.contactFields.count);
+        for (OHContactField *contactField in self.contactFields) {
+            fingerprint = OHContentFingerprintCombine(fingerprint, contactField.contentFingerprint);
+        }
+        fingerprint = OHContentFingerprintCombine(fingerprint, (OHContentFingerprint)self.postalAddresses.count);
+        for (OHContactAddress *postalAddress in self.postalAddresses) {
+            fingerprint = OHContentFingerprintCombine(fingerprint, postalAddress.contentFingerprint);
+        }
+#if TARGET_OS_IPHONE
+        fingerprint = OHContentFingerprintCombine(fingerprint, [self _thumbnailFingerprint]);
+#endif
+        self.cachedContentFingerprint = fingerprint ?: 1;
+    }
+    return self.cachedContentFingerprint;
+}
 
 - (NSMutableSet<NSString *> *)tags
 {
@@ -50,6 +159,22 @@
     return _customProperties;
 }
 
+#pragma mark - Private
+
+- (void)_updateContactFieldTypes
+{
+    memset(_contactFieldCounts, 0, sizeof(_contactFieldCounts));
+    OHContactFieldTypeMask contactFieldTypes = 0;
+    for (OHContactField *contactField in _contactFields) {
+        OHContactFieldType type = contactField.type;
+        if (type >= 0 && type <= OHContactFieldTypeOther) {
+            _contactFieldCounts[type]++;
+            contactFieldTypes |= OHContactFieldTypeMaskForType(type);
+        }
+    }
+    _contactFieldTypes = contactFieldTypes;
+}
+
 #pragma mark - NSCopying
 
 - (id)copyWithZone:(NSZone *)zone
@@ -63,7 +188,9 @@
     copy.departmentName = [self.departmentName copy];
     copy.contactFields = [self.contactFields copy];
     copy.postalAddresses = [self.postalAddresses copy];
+#if TARGET_OS_IPHONE
     copy.thumbnailPhoto = [self.thumbnailPhoto copy];
+#endif
     copy.tags = [self.tags mutableCopy];
     copy.customProperties = [self.customProperties mutableCopy];
     return copy;
@@ -73,7 +200,8 @@
 
 - (BOOL)isEqualToContact:(OHContact *)contact
 {
-    return  ((!self.fullName && !contact.fullName) || [self.fullName isEqualToString:contact.fullName]) &&
+    return  self.contentFingerprint == contact.contentFingerprint &&
+            ((!self.fullName && !contact.fullName) || [self.fullName isEqualToString:contact.fullName]) &&
             ((!self.firstName && !contact.firstName) || [self.firstName isEqualToString:contact.firstName]) &&
             ((!self.lastName && !contact.lastName) || [self.lastName isEqualToString:contact.lastName]) &&
             ((!self.organizationName && !contact.organizationName) || [self.organizationName isEqualToString:contact.organizationName]) &&
@@ -81,7 +209,9 @@
             ((!self.departmentName && !contact.departmentName) || [self.departmentName isEqualToString:contact.departmentName]) &&
             [self _contactFieldsIsEqualToContactFields:contact.contactFields] &&
             [self _postalAddressesIsEqualToPostalAddresses:contact.postalAddresses] &&
-            [self _thumbnailImageIsEqualToThumbnailImage:contact.thumbnailPhoto] &&
+#if TARGET_OS_IPHONE
+            [self _thumbnailPhotoIsEqualToThumbnailPhotoOfContact:contact] &&
+#endif
             [self.tags isEqualToSet:contact.tags] &&
             [self.customProperties isEqualToDictionary:contact.customProperties];
 }
@@ -118,15 +248,23 @@
     return YES;
 }
 
-- (BOOL)_thumbnailImageIsEqualToThumbnailImage:(UIImage *)thumbnailPhoto
+#if TARGET_OS_IPHONE
+- (BOOL)_thumbnailPhotoIsEqualToThumbnailPhotoOfContact:(OHContact *)contact
 {
-    if (self.thumbnailPhoto && thumbnailPhoto) {
-        NSData *selfData = UIImagePNGRepresentation(self.thumbnailPhoto);
-        NSData *otherData = UIImagePNGRepresentation(thumbnailPhoto);
+    if (self.thumbnailPhoto && contact.thumbnailPhoto) {
+        // Compares the hashes of the raw pixel data instead of encoding both images
+        return [self _thumbnailFingerprint] == [contact _thumbnailFingerprint];
+    }
+    return self.thumbnailPhoto == nil && contact.thumbnailPhoto == nil;
+}
 
-        return [selfData isEqualToData:otherData];
+- (OHContentFingerprint)_thumbnailFingerprint
+{
+    if (!self.cachedThumbnailFingerprint) {
+        self.cachedThumbnailFingerprint = OHContentFingerprintOfImage(self.thumbnailPhoto) ?: 1;
     }
-    return self.thumbnailPhoto == nil && thumbnailPhoto == nil;
+    return self.cachedThumbnailFingerprint;
 }
+#endif
 
 @end
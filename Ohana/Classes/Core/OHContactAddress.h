@@ -25,6 +25,8 @@
 
 #import <Foundation/Foundation.h>
 
+#import "OHContentFingerprint.h"
+
 NS_ASSUME_NONNULL_BEGIN
 
 @interface OHContactAddress : NSObject <NSCopying>
@@ -81,6 +83,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly) NSString *dataProviderIdentifier;
 
+/**
+ *  Fingerprint of the label, address components and data provider identifier, computed once
+ *
+ *  @discussion Tags and custom properties are not included since they can be mutated in place
+ */
+@property (nonatomic, readonly) OHContentFingerprint contentFingerprint;
+
 - (BOOL)isEqualToContactAddress:(OHContactAddress *)contactAddress;
 
 @end
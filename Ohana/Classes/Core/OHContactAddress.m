@@ -30,6 +30,11 @@
 @property (nonatomic, readwrite) NSMutableSet<NSString *> *tags;
 @property (nonatomic, readwrite) NSMutableDictionary<NSString *, id> *customProperties;
 
+/**
+ *  Lazily computed content fingerprint, 0 until computed
+ */
+@property (nonatomic) OHContentFingerprint cachedContentFingerprint;
+
 @end
 
 @implementation OHContactAddress
@@ -75,6 +80,21 @@
     return _customProperties;
 }
 
+- (OHContentFingerprint)contentFingerprint
+{
+    if (!self.cachedContentFingerprint) {
+        OHContentFingerprint fingerprint = OHContentFingerprintCombine(kOHContentFingerprintSeed, OHContentFingerprintOfString(self.label));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.street));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.city));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.state));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.postalCode));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.country));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.dataProviderIdentifier));
+        self.cachedContentFingerprint = fingerprint ?: 1;
+    }
+    return self.cachedContentFingerprint;
+}
+
 #pragma mark - NSCopying
 
 - (id)copyWithZone:(NSZone *)zone
@@ -86,7 +106,8 @@
 
 - (BOOL)isEqualToContactAddress:(OHContactAddress *)contactAddress
 {
-    return  [self.label isEqualToString:contactAddress.label] &&
+    return  self.contentFingerprint == contactAddress.contentFingerprint &&
+            [self.label isEqualToString:contactAddress.label] &&
             [self.street isEqualToString:contactAddress.street] &&
             [self.city isEqualToString:contactAddress.city] &&
             [self.state isEqualToString:contactAddress.state] &&
@@ -25,6 +25,8 @@
 
 #import <Foundation/Foundation.h>
 
+#import "OHContentFingerprint.h"
+
 typedef NS_ENUM(NSInteger, OHContactFieldType) {
     OHContactFieldTypePhoneNumber = 0,
     OHContactFieldTypeEmailAddress,
@@ -32,8 +34,33 @@ typedef NS_ENUM(NSInteger, OHContactFieldType) {
     OHContactFieldTypeOther
 };
 
+/**
+ *  Bit mask of contact field types, with the bit `1 << type` set for each type
+ */
+typedef NS_OPTIONS(NSUInteger, OHContactFieldTypeMask) {
+    OHContactFieldTypeMaskPhoneNumber   = 1 << OHContactFieldTypePhoneNumber,
+    OHContactFieldTypeMaskEmailAddress  = 1 << OHContactFieldTypeEmailAddress,
+    OHContactFieldTypeMaskURL           = 1 << OHContactFieldTypeURL,
+    OHContactFieldTypeMaskOther         = 1 << OHContactFieldTypeOther
+};
+
+/**
+ *  Mask with only the bit of the given contact field type set
+ */
+NS_INLINE OHContactFieldTypeMask OHContactFieldTypeMaskForType(OHContactFieldType type)
+{
+    return (OHContactFieldTypeMask)1 << type;
+}
+
 NS_ASSUME_NONNULL_BEGIN
 
+@class OHContactField;
+
+/**
+ *  Computes a custom property of a contact field on demand, returning nil if the field has no value for it
+ */
+typedef id _Nullable (^OHContactFieldCustomPropertyProvider)(OHContactField *contactField);
+
 @interface OHContactField : NSObject <NSCopying>
 
 /**
@@ -68,11 +95,35 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly) NSMutableDictionary<NSString *, id> *customProperties;
 
+/**
+ *  Providers of custom properties that are computed on first access, keyed by custom property key
+ *
+ *  @discussion Lets post processors register a custom property without paying to compute it for every field. The same
+ *  dictionary is meant to be shared between all the fields a post processor handles. Values are only computed through
+ *  customPropertyForKey:, and are memoized separately from customProperties, so they are not written to snapshots.
+ *  Setting new providers discards the values memoized from the previous ones.
+ */
+@property (nonatomic, copy, nullable) NSDictionary<NSString *, OHContactFieldCustomPropertyProvider> *customPropertyProviders;
+
+/**
+ *  Returns the custom property for the key, computing and memoizing it from customPropertyProviders if it is not set
+ *
+ *  @discussion Safe to call from any thread, each provided value is computed at most once per contact field.
+ */
+- (nullable id)customPropertyForKey:(NSString *)key;
+
 /**
  *  Identifier of the data provider that created the contact field
  */
 @property (nonatomic, readonly) NSString *dataProviderIdentifier;
 
+/**
+ *  Fingerprint of the type, label, value and data provider identifier, computed once
+ *
+ *  @discussion Tags and custom properties are not included since they can be mutated in place
+ */
+@property (nonatomic, readonly) OHContentFingerprint contentFingerprint;
+
 - (BOOL)isEqualToContactField:(OHContactField *)contactField;
 
 @end
@@ -30,6 +30,16 @@
 @property (nonatomic, readwrite) NSMutableSet<NSString *> *tags;
 @property (nonatomic, readwrite) NSMutableDictionary<NSString *, id> *customProperties;
 
+/**
+ *  Lazily computed content fingerprint, 0 until computed
+ */
+@property (nonatomic) OHContentFingerprint cachedContentFingerprint;
+
+/**
+ *  Memoized values of customPropertyProviders, with NSNull for providers that returned nil, only accessed while synchronized on self
+ */
+@property (nonatomic, nullable) NSMutableDictionary<NSString *, id> *providedCustomProperties;
+
 @end
 
 @implementation OHContactField
@@ -72,18 +82,75 @@
     return _customProperties;
 }
 
+- (nullable NSDictionary<NSString *, OHContactFieldCustomPropertyProvider> *)customPropertyProviders
+{
+    @synchronized(self) {
+        return _customPropertyProviders;
+    }
+}
+
+- (void)setCustomPropertyProviders:(nullable NSDictionary<NSString *, OHContactFieldCustomPropertyProvider> *)customPropertyProviders
+{
+    @synchronized(self) {
+        _customPropertyProviders = [customPropertyProviders copy];
+        self.providedCustomProperties = nil;
+    }
+}
+
+- (OHContentFingerprint)contentFingerprint
+{
+    if (!self.cachedContentFingerprint) {
+        OHContentFingerprint fingerprint = OHContentFingerprintCombine(kOHContentFingerprintSeed, (OHContentFingerprint)self.type);
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.label));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.value));
+        fingerprint = OHContentFingerprintCombine(fingerprint, OHContentFingerprintOfString(self.dataProviderIdentifier));
+        self.cachedContentFingerprint = fingerprint ?: 1;
+    }
+    return self.cachedContentFingerprint;
+}
+
+- (nullable id)customPropertyForKey:(NSString *)key
+{
+    id customProperty = [_customProperties objectForKey:key];
+    if (customProperty) {
+        return customProperty;
+    }
+    @synchronized(self) {
+        // Read under the lock, since the providers may be replaced on another thread and the dictionary freed
+        OHContactFieldCustomPropertyProvider provider = [_customPropertyProviders objectForKey:key];
+        if (!provider) {
+            return nil;
+        }
+        customProperty = [self.providedCustomProperties objectForKey:key];
+        if (!customProperty) {
+            customProperty = provider(self) ?: [NSNull null];
+            if (!self.providedCustomProperties) {
+                self.providedCustomProperties = [[NSMutableDictionary<NSString *, id> alloc] init];
+            }
+            [self.providedCustomProperties setObject:customProperty forKey:key];
+        }
+    }
+    return customProperty == [NSNull null] ? nil : customProperty;
+}
+
 #pragma mark - NSCopying
 
 - (id)copyWithZone:(NSZone *)zone
 {
-    return [[OHContactField alloc] initWithType:self.type label:[self.label copy] value:[self.value copy] dataProviderIdentifier:[self.dataProviderIdentifier copy] tags:[self.tags copy] customProperties:[self.customProperties copy]];
+    OHContactField *contactField = [[OHContactField alloc] initWithType:self.type label:[self.label copy] value:[self.value copy] dataProviderIdentifier:[self.dataProviderIdentifier copy] tags:[self.tags copy] customProperties:[self.customProperties copy]];
+    @synchronized(self) {
+        contactField.customPropertyProviders = _customPropertyProviders;
+        contactField.providedCustomProperties = [self.providedCustomProperties mutableCopy];
+    }
+    return contactField;
 }
 
 #pragma mark - Equality
 
 - (BOOL)isEqualToContactField:(OHContactField *)contactField
 {
-    return  self.type == contactField.type &&
+    return  self.contentFingerprint == contactField.contentFingerprint &&
+            self.type == contactField.type &&
             [self.label isEqualToString:contactField.label] &&
             [self.value isEqualToString:contactField.value] &&
             [self.dataProviderIdentifier isEqualToString:contactField.dataProviderIdentifier] &&
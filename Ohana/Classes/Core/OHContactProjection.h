@@ -0,0 +1,62 @@
+//
+//  OHContactProjection.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "OHContact.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Lightweight contact that presents one contact field of another contact
+ *
+ *  @discussion Reads of the names, postal addresses and thumbnail photo are forwarded to the projected contact, and contactFields only
+ *  holds the projected contact field, so creating a projection copies nothing. Setting a property stores the new value on the projection
+ *  and leaves the projected contact untouched. Tags and custom properties are copied from the projected contact the first time they are
+ *  accessed, since they are mutated in place. Copying a projection returns a regular contact.
+ */
+@interface OHContactProjection : OHContact
+
+/**
+ *  @param contact Contact to project
+ *  @param contactField One of the contact's contact fields
+ */
+- (instancetype)initWithContact:(OHContact *)contact contactField:(OHContactField *)contactField NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Projected contact
+ */
+@property (nonatomic, readonly) OHContact *contact;
+
+/**
+ *  Projected contact field
+ */
+@property (nonatomic, readonly) OHContactField *contactField;
+
+@end
+
+NS_ASSUME_NONNULL_END
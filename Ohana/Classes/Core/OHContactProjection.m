@@ -0,0 +1,227 @@
+//
+//  OHContactProjection.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHContactProjection.h"
+
+/**
+ *  Properties that were set on the projection and are no longer forwarded to the projected contact
+ */
+typedef NS_OPTIONS(NSUInteger, OHContactProjectionProperty) {
+    OHContactProjectionPropertyFullName         = 1 << 0,
+    OHContactProjectionPropertyFirstName        = 1 << 1,
+    OHContactProjectionPropertyLastName         = 1 << 2,
+    OHContactProjectionPropertyOrganizationName = 1 << 3,
+    OHContactProjectionPropertyJobTitle         = 1 << 4,
+    OHContactProjectionPropertyDepartmentName   = 1 << 5,
+    OHContactProjectionPropertyContactFields    = 1 << 6,
+    OHContactProjectionPropertyPostalAddresses  = 1 << 7,
+    OHContactProjectionPropertyThumbnailPhoto   = 1 << 8
+};
+
+@interface OHContactProjection ()
+
+@property (nonatomic) OHContactProjectionProperty setProperties;
+
+/**
+ *  Lazily created containers, only accessed while synchronized on self
+ */
+@property (nonatomic, nullable) NSOrderedSet<OHContactField *> *projectedContactFields;
+@property (nonatomic, nullable) NSMutableSet<NSString *> *projectedTags;
+@property (nonatomic, nullable) NSMutableDictionary<NSString *, id> *projectedCustomProperties;
+
+@end
+
+@implementation OHContactProjection
+
+- (instancetype)initWithContact:(OHContact *)contact contactField:(OHContactField *)contactField
+{
+    if (self = [super init]) {
+        _contact = contact;
+        _contactField = contactField;
+    }
+    return self;
+}
+
+#pragma mark - Names
+
+- (NSString *)fullName
+{
+    return self.setProperties & OHContactProjectionPropertyFullName ? [super fullName] : self.contact.fullName;
+}
+
+- (void)setFullName:(NSString *)fullName
+{
+    [super setFullName:fullName];
+    self.setProperties |= OHContactProjectionPropertyFullName;
+}
+
+- (NSString *)firstName
+{
+    return self.setProperties & OHContactProjectionPropertyFirstName ? [super firstName] : self.contact.firstName;
+}
+
+- (void)setFirstName:(NSString *)firstName
+{
+    [super setFirstName:firstName];
+    self.setProperties |= OHContactProjectionPropertyFirstName;
+}
+
+- (NSString *)lastName
+{
+    return self.setProperties & OHContactProjectionPropertyLastName ? [super lastName] : self.contact.lastName;
+}
+
+- (void)setLastName:(NSString *)lastName
+{
+    [super setLastName:lastName];
+    self.setProperties |= OHContactProjectionPropertyLastName;
+}
+
+- (NSString *)organizationName
+{
+    return self.setProperties & OHContactProjectionPropertyOrganizationName ? [super organizationName] : self.contact.organizationName;
+}
+
+- (void)setOrganizationName:(NSString *)organizationName
+{
+    [super setOrganizationName:organizationName];
+    self.setProperties |= OHContactProjectionPropertyOrganizationName;
+}
+
+- (NSString *)jobTitle
+{
+    return self.setProperties & OHContactProjectionPropertyJobTitle ? [super jobTitle] : self.contact.jobTitle;
+}
+
+- (void)setJobTitle:(NSString *)jobTitle
+{
+    [super setJobTitle:jobTitle];
+    self.setProperties |= OHContactProjectionPropertyJobTitle;
+}
+
+- (NSString *)departmentName
+{
+    return self.setProperties & OHContactProjectionPropertyDepartmentName ? [super departmentName] : self.contact.departmentName;
+}
+
+- (void)setDepartmentName:(NSString *)departmentName
+{
+    [super setDepartmentName:departmentName];
+    self.setProperties |= OHContactProjectionPropertyDepartmentName;
+}
+
+#pragma mark - Contact Fields
+
+- (NSOrderedSet<OHContactField *> *)contactFields
+{
+    if (self.setProperties & OHContactProjectionPropertyContactFields) {
+        return [super contactFields];
+    }
+    @synchronized(self) {
+        if (!self.projectedContactFields) {
+            self.projectedContactFields = [NSOrderedSet orderedSetWithObject:self.contactField];
+        }
+        return self.projectedContactFields;
+    }
+}
+
+- (void)setContactFields:(NSOrderedSet<OHContactField *> *)contactFields
+{
+    [super setContactFields:contactFields];
+    self.setProperties |= OHContactProjectionPropertyContactFields;
+}
+
+- (OHContactFieldTypeMask)contactFieldTypes
+{
+    if (self.setProperties & OHContactProjectionPropertyContactFields) {
+        return [super contactFieldTypes];
+    }
+    return OHContactFieldTypeMaskForType(self.contactField.type);
+}
+
+- (BOOL)hasContactFieldOfType:(OHContactFieldType)type
+{
+    return (self.contactFieldTypes & OHContactFieldTypeMaskForType(type)) != 0;
+}
+
+- (NSUInteger)numberOfContactFieldsOfType:(OHContactFieldType)type
+{
+    if (self.setProperties & OHContactProjectionPropertyContactFields) {
+        return [super numberOfContactFieldsOfType:type];
+    }
+    return self.contactField.type == type ? 1 : 0;
+}
+
+#pragma mark - Postal Addresses
+
+- (NSOrderedSet<OHContactAddress *> *)postalAddresses
+{
+    return self.setProperties & OHContactProjectionPropertyPostalAddresses ? [super postalAddresses] : self.contact.postalAddresses;
+}
+
+- (void)setPostalAddresses:(NSOrderedSet<OHContactAddress *> *)postalAddresses
+{
+    [super setPostalAddresses:postalAddresses];
+    self.setProperties |= OHContactProjectionPropertyPostalAddresses;
+}
+
+#if TARGET_OS_IPHONE
+#pragma mark - Thumbnail Photo
+
+- (UIImage *)thumbnailPhoto
+{
+    return self.setProperties & OHContactProjectionPropertyThumbnailPhoto ? [super thumbnailPhoto] : self.contact.thumbnailPhoto;
+}
+
+- (void)setThumbnailPhoto:(UIImage *)thumbnailPhoto
+{
+    [super setThumbnailPhoto:thumbnailPhoto];
+    self.setProperties |= OHContactProjectionPropertyThumbnailPhoto;
+}
+#endif
+
+#pragma mark - Tags and Custom Properties
+
+- (NSMutableSet<NSString *> *)tags
+{
+    @synchronized(self) {
+        if (!self.projectedTags) {
+            self.projectedTags = [self.contact.tags mutableCopy];
+        }
+        return self.projectedTags;
+    }
+}
+
+- (NSMutableDictionary<NSString *, id> *)customProperties
+{
+    @synchronized(self) {
+        if (!self.projectedCustomProperties) {
+            self.projectedCustomProperties = [self.contact.customProperties mutableCopy];
+        }
+        return self.projectedCustomProperties;
+    }
+}
+
+@end
@@ -0,0 +1,51 @@
+//
+//  OHContactsChangeSourceProtocol.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <UberSignals/UberSignals.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@protocol OHContactsChangeSourceProtocol;
+
+/**
+ *  Signal to be fired when contacts have changed in the underlying contact store
+ *
+ *  @param contactIdentifiers Identifiers of the contacts that changed, or nil if the change source cannot tell which contacts changed
+ *  @param changeSource The change source that observed the change
+ */
+CreateSignalInterface(OHContactsChangeSourceChangedSignal, NSSet<NSString *> *_Nullable contactIdentifiers, id<OHContactsChangeSourceProtocol> changeSource);
+
+@protocol OHContactsChangeSourceProtocol <NSObject>
+
+/**
+ *  Signal to be fired when contacts have changed in the underlying contact store (see signal definition)
+ *
+ *  @discussion The signal may be fired on any queue and as often as the underlying store notifies, the data source coalesces bursts of changes
+ */
+@property (nonatomic, readonly) OHContactsChangeSourceChangedSignal *onContactsChangeSourceChangedSignal;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -56,6 +56,16 @@ CreateSignalInterface(OHContactsDataProviderFinishedLoadingSignal, id<OHContacts
  */
 CreateSignalInterface(OHContactsDataProviderErrorSignal, NSError *error, id<OHContactsDataProviderProtocol> dataProvider);
 
+/**
+ *  Signal to be fired each time the contacts data provider has loaded a batch of contacts, before it finishes loading
+ *
+ *  @discussion Batches are fired in the same order as the contacts will appear in the contacts property once loading has finished
+ *
+ *  @param contacts The contacts in the batch
+ *  @param dataProvider The data provider that loaded the batch
+ */
+CreateSignalInterface(OHContactsDataProviderBatchLoadedSignal, NSOrderedSet<OHContact *> *contacts, id<OHContactsDataProviderProtocol> dataProvider);
+
 typedef NS_ENUM(NSInteger, OHContactsDataProviderErrorCode) {
     OHContactsDataProviderErrorCodeUnknown,            // Default
     OHContactsDataProviderErrorCodeAuthenticationError // Indicates that a failure occurred with authentication after (or before) an authentication challenge
@@ -102,6 +112,57 @@ extern NSString *const OHContactsDataProviderErrorDomain;
  */
 + (NSString *)providerIdentifier;
 
+@optional
+
+/**
+ *  Signal to be fired each time the contacts data provider has loaded a batch of contacts (see signal definition)
+ *
+ *  @discussion Data providers that implement this should fire the signal only when batchSize is greater than zero
+ */
+@property (nonatomic, readonly) OHContactsDataProviderBatchLoadedSignal *onContactsDataProviderBatchLoadedSignal;
+
+/**
+ *  Maximum number of contacts in each batch fired on onContactsDataProviderBatchLoadedSignal
+ *
+ *  @discussion Defaults to 0, which disables batch delivery
+ */
+@property (nonatomic) NSUInteger batchSize;
+
+/**
+ *  Time spent transforming store records into OHContact objects during the last load
+ *
+ *  @discussion Reported in the data source metrics to split the load time of the data provider into fetching and transforming
+ */
+@property (nonatomic, readonly) NSTimeInterval lastLoadTransformDuration;
+
+/**
+ *  Stops the load in progress, if any, without firing onContactsDataProviderFinishedLoadingSignal or onContactsDataProviderErrorSignal for it
+ *
+ *  @discussion Called by the data source on data providers that have not finished loading when loadContacts is called again, before loading
+ *  them again. Cancellation is cooperative: batches already fired stay delivered, and a load that is about to finish may still finish.
+ */
+- (void)cancelLoading;
+
+/**
+ *  Returns the identifier of a contact loaded by this data provider, unique among the contacts in the underlying store
+ *
+ *  @discussion Used to match contacts across refreshes. Should return nil for contacts the data provider did not load.
+ */
+- (NSString *_Nullable)contactIdentifierForContact:(OHContact *)contact;
+
+/**
+ *  Synchronously fetches the contacts with the given identifiers from the underlying store
+ *
+ *  @discussion Called on a background queue when the data source is refreshing contacts after a change. Identifiers of contacts that no
+ *  longer exist are left out of the result. This method does not update the contacts property.
+ *
+ *  @param contactIdentifiers Identifiers of the contacts to fetch, or nil to fetch all contacts
+ *  @param error              Set if the fetch failed
+ *
+ *  @return The fetched contacts, or nil if the fetch failed
+ */
+- (NSOrderedSet<OHContact *> *_Nullable)fetchContactsWithIdentifiers:(NSSet<NSString *> *_Nullable)contactIdentifiers error:(NSError *_Nullable *_Nullable)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
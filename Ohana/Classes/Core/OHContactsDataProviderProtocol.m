@@ -29,4 +29,6 @@ CreateSignalImplementation(OHContactsDataProviderFinishedLoadingSignal, id<OHCon
 
 CreateSignalImplementation(OHContactsDataProviderErrorSignal, NSError *error, id<OHContactsDataProviderProtocol> dataProvider);
 
+CreateSignalImplementation(OHContactsDataProviderBatchLoadedSignal, NSOrderedSet<OHContact *> *contacts, id<OHContactsDataProviderProtocol> dataProvider);
+
 NSString *const OHContactsDataProviderErrorDomain = @"com.uber.ohana.dataprovider";
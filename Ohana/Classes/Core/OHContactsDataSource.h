@@ -26,7 +26,14 @@
 #import <Foundation/Foundation.h>
 
 #import "OHContact.h"
+#import "OHContactsChangeSourceProtocol.h"
 #import "OHContactsDataProviderProtocol.h"
+#import "OHContactsDataSourceChange.h"
+#import "OHContactsDataSourceMetrics.h"
+#import "OHContactsDataSourceTracingProtocol.h"
+#import "OHContactsIndexVectorPostProcessorProtocol.h"
+#import "OHContactsMerger.h"
+#import "OHContactsSnapshotStore.h"
 #import "OHContactsPostProcessorProtocol.h"
 #import "OHContactsSelectionFilterProtocol.h"
 
@@ -39,6 +46,35 @@ NS_ASSUME_NONNULL_BEGIN
 
 CreateSignalInterface(OHContactsDataSourceReadySignal, NSOrderedSet<OHContact *> *contacts);
 
+/**
+ *  Signal fired while the data providers are still loading, with the contacts loaded so far processed by the post processors
+ *
+ *  @discussion Only fired for data providers that support batch delivery, see OHContactsDataProviderBatchLoadedSignal
+ */
+CreateSignalInterface(OHContactsDataSourcePartialReadySignal, NSOrderedSet<OHContact *> *contacts);
+
+/**
+ *  Signal fired when contacts from the snapshot store are available, before the first load has finished
+ *
+ *  @param contacts The contacts read from the snapshot store
+ */
+CreateSignalInterface(OHContactsDataSourceSnapshotLoadedSignal, NSOrderedSet<OHContact *> *contacts);
+
+/**
+ *  Signal fired after the data source has refreshed its contacts in response to a change reported by its change source
+ *
+ *  @param contacts The new value of the contacts property
+ *  @param change   The removed, inserted, updated and moved indexes relative to the previous value of the contacts property
+ */
+CreateSignalInterface(OHContactsDataSourceChangedSignal, NSOrderedSet<OHContact *> *contacts, OHContactsDataSourceChange *change);
+
+/**
+ *  Signal fired with the metrics of each pipeline run, right after onContactsDataSourceReadySignal
+ *
+ *  @param metrics Timings and counts collected from loadContacts (or reprocessContacts) to the ready signal
+ */
+CreateSignalInterface(OHContactsDataSourceMetricsSignal, OHContactsDataSourceMetrics *metrics);
+
 /**
  *  Signal fired after the data source selects contacts
  *
@@ -53,6 +89,21 @@ CreateSignalInterface(OHContactsDataSourceSelectedContactsSignal, NSOrderedSet<O
  */
 CreateSignalInterface(OHContactsDataSourceDeselectedContactsSignal, NSOrderedSet<OHContact *> *_Nullable deselectedContacts);
 
+typedef NS_ENUM(NSInteger, OHContactsDataSourceLoadingMode) {
+    OHContactsDataSourceLoadingModeSerial,      // Default, data providers load one after another on the thread that called loadContacts
+    OHContactsDataSourceLoadingModeConcurrent   // Data providers load at the same time on a background queue managed by the data source
+};
+
+typedef NS_ENUM(NSInteger, OHContactsDataSourceProcessingMode) {
+    OHContactsDataSourceProcessingModeInline,       // Default, post processors run on the queue the last data provider finished loading on
+    OHContactsDataSourceProcessingModeBackground    // Post processors run on a serial background queue managed by the data source
+};
+
+typedef NS_ENUM(NSInteger, OHContactsDataSourceFailurePolicy) {
+    OHContactsDataSourceFailurePolicyWait,  // Default, a data provider that fires its error signal is still waited for
+    OHContactsDataSourceFailurePolicySkip   // A data provider that fires its error signal is treated as finished without contacts
+};
+
 @interface OHContactsDataSource : NSObject
 
 /**
@@ -62,6 +113,65 @@ CreateSignalInterface(OHContactsDataSourceDeselectedContactsSignal, NSOrderedSet
  */
 @property (nonatomic, nullable) NSOrderedSet<id<OHContactsSelectionFilterProtocol>> *selectionFilters;
 
+/**
+ *  Mode used to ask the data providers to load their contacts
+ *
+ *  @discussion Defaults to OHContactsDataSourceLoadingModeSerial. When set to OHContactsDataSourceLoadingModeConcurrent, every data provider's
+ *  loadContacts method (and therefore any data provider delegate callback) is invoked on a background queue, and the post processors run once
+ *  the last data provider has finished loading.
+ */
+@property (nonatomic) OHContactsDataSourceLoadingMode loadingMode;
+
+/**
+ *  Mode used to run the post processors once all data providers have finished loading
+ *
+ *  @discussion Defaults to OHContactsDataSourceProcessingModeInline. When set to OHContactsDataSourceProcessingModeBackground, the post
+ *  processors always run on the data source's internal serial queue, so expensive stages never run on the main thread even when the last
+ *  data provider finished loading there (for example after an authentication prompt).
+ */
+@property (nonatomic) OHContactsDataSourceProcessingMode processingMode;
+
+/**
+ *  Quality of service of the internal serial queue used in OHContactsDataSourceProcessingModeBackground
+ *
+ *  @discussion Defaults to NSQualityOfServiceUserInitiated. Changes take effect on the next call to loadContacts.
+ */
+@property (nonatomic) NSQualityOfService processingQualityOfService;
+
+/**
+ *  Time after loadContacts is called at which the data source stops waiting for the data providers that have not finished loading
+ *
+ *  @discussion Defaults to 0, which waits for every data provider. When the deadline passes first, the post processors run on the contacts
+ *  of the data providers that have finished and onContactsDataSourceReadySignal fires with the `partial` property set. The contacts of each
+ *  data provider that finishes afterwards are merged in by re-running the post processors, and delivered through
+ *  onContactsDataSourceChangedSignal. Both passes run on the data source's internal serial queue. Changes take effect on the next call to
+ *  loadContacts.
+ */
+@property (nonatomic) NSTimeInterval readinessDeadline;
+
+/**
+ *  How a data provider that fires onContactsDataProviderErrorSignal while loading is handled
+ *
+ *  @discussion Defaults to OHContactsDataSourceFailurePolicyWait, under which only the readiness deadline (if set) stops the data source from
+ *  waiting for it.
+ */
+@property (nonatomic) OHContactsDataSourceFailurePolicy failurePolicy;
+
+/**
+ *  Queue on which the `contacts` property is set and onContactsDataSourceReadySignal is fired (optional)
+ *
+ *  @discussion If nil, the signal is fired on the queue the post processors ran on.
+ */
+@property (nonatomic, nullable) dispatch_queue_t deliveryQueue;
+
+/**
+ *  Merger used to combine the contacts of different data providers that represent the same person (optional)
+ *
+ *  @discussion If nil, the contacts of all data providers are passed to the post processors as they are. If set, the merge runs before the
+ *  post processors, so they receive one contact per person. Changes take effect on the next call to loadContacts.
+ */
+@property (nonatomic, nullable) OHContactsMerger *contactsMerger;
+
 /**
  *  Signal fired after the data source is ready to be used
  *
@@ -69,6 +179,64 @@ CreateSignalInterface(OHContactsDataSourceDeselectedContactsSignal, NSOrderedSet
  */
 @property (nonatomic, readonly) OHContactsDataSourceReadySignal *onContactsDataSourceReadySignal;
 
+/**
+ *  Signal fired with the metrics of each pipeline run, on the same queue as onContactsDataSourceReadySignal
+ */
+@property (nonatomic, readonly) OHContactsDataSourceMetricsSignal *onContactsDataSourceMetricsSignal;
+
+/**
+ *  Receiver of stage begin and end events, for forwarding the pipeline timings to a tracing system (optional)
+ */
+@property (nonatomic, weak, nullable) id<OHContactsDataSourceTracingProtocol> tracer;
+
+/**
+ *  Signal fired when a partial result is available while the data providers are still loading
+ *
+ *  @discussion Partial results are only produced in OHContactsDataSourceProcessingModeBackground, so that they are serialized with the final
+ *  result. Batches that arrive while a partial result is being processed are coalesced into the next one, and no partial result is fired after
+ *  onContactsDataSourceReadySignal for the same load. The `contacts` property is not updated by partial results.
+ */
+@property (nonatomic, readonly) OHContactsDataSourcePartialReadySignal *onContactsDataSourcePartialReadySignal;
+
+/**
+ *  Signal fired when contacts from the snapshot store are available, before the first load has finished
+ *
+ *  @discussion When this signal is fired, the `contacts` property will have been set to the snapshot. The snapshot contacts are different
+ *  objects from the ones delivered by onContactsDataSourceReadySignal, which replaces them once the live load has finished.
+ */
+@property (nonatomic, readonly) OHContactsDataSourceSnapshotLoadedSignal *onContactsDataSourceSnapshotLoadedSignal;
+
+/**
+ *  Store used to show the contacts of the previous run while the first load is in progress (optional)
+ *
+ *  @discussion On the first call to loadContacts, the snapshot is read (on the processing queue in OHContactsDataSourceProcessingModeBackground)
+ *  and delivered through onContactsDataSourceSnapshotLoadedSignal, unless the live result is already available. Every processed result is
+ *  written back to the store on a background queue.
+ */
+@property (nonatomic, nullable) OHContactsSnapshotStore *snapshotStore;
+
+/**
+ *  Signal fired after the data source has refreshed its contacts in response to a change reported by its change source
+ */
+@property (nonatomic, readonly) OHContactsDataSourceChangedSignal *onContactsDataSourceChangedSignal;
+
+/**
+ *  Source of contact store change notifications (optional)
+ *
+ *  @discussion Once the data source is ready, each change reported by the change source is handled by re-fetching only the changed contacts
+ *  from the data providers that implement fetchContactsWithIdentifiers:error: and contactIdentifierForContact:, re-running the post processors,
+ *  and firing onContactsDataSourceChangedSignal. Changes to contacts are detected by comparing the data loaded from the store, so updated
+ *  contacts are replaced by new objects while unchanged contacts are kept. The selectedContacts property is not updated.
+ */
+@property (nonatomic, nullable) id<OHContactsChangeSourceProtocol> changeSource;
+
+/**
+ *  Time to wait after a change is reported before refreshing, so that bursts of changes are handled by a single refresh
+ *
+ *  @discussion Defaults to 0.3 seconds
+ */
+@property (nonatomic) NSTimeInterval changeCoalescingInterval;
+
 /**
  *  Signal fired after the data source selects contacts
  */
@@ -86,6 +254,14 @@ CreateSignalInterface(OHContactsDataSourceDeselectedContactsSignal, NSOrderedSet
  */
 @property (nonatomic, readonly, nullable) NSOrderedSet<OHContact *> *contacts;
 
+/**
+ *  Whether the `contacts` property is missing the contacts of data providers that had not finished loading at the readiness deadline, or
+ *  that failed under OHContactsDataSourceFailurePolicySkip
+ *
+ *  @discussion Set together with the `contacts` property, before the ready and changed signals fire
+ */
+@property (nonatomic, readonly, getter=isPartial) BOOL partial;
+
 /**
  *  Set of selected contacts
  */
@@ -128,9 +304,30 @@ typedef BOOL (^FilterContactsBlock)(OHContact *contact);
 /**
  *  Tells the data source to begin loading contacts data from the data providers and then pass that contact data through the post processors.
  *  This method fires several important events that should be observed on to act on the contact data, see above for more information on the available signals.
+ *
+ *  @discussion Calling this method while a previous load is still in progress supersedes it: data providers that have not finished are asked
+ *  to cancel, post processing of the previous load stops at the next stage, and its results are never delivered.
  */
 - (void)loadContacts;
 
+/**
+ *  Replaces the post processors and re-runs them on the loaded contacts
+ *
+ *  @discussion If contacts have been loaded, onContactsDataSourceReadySignal fires again with the new result. Stages before the first post
+ *  processor whose configurationFingerprint changed reuse their previous output, so replacing a later post processor only re-runs the stages
+ *  from that post processor onwards.
+ *
+ *  @param postProcessors The new post processors (optional)
+ */
+- (void)updatePostProcessors:(NSOrderedSet<id<OHContactsPostProcessorProtocol>> *_Nullable)postProcessors;
+
+/**
+ *  Re-runs the post processors on the loaded contacts, for example after reconfiguring one of them
+ *
+ *  @discussion Does nothing until contacts have been loaded. Stages are reused as described in updatePostProcessors:.
+ */
+- (void)reprocessContacts;
+
 /**
  *  Method used to filter on the contacts in the data source, each contact in the data source will be passed through
  *  the provided filterContactsBlock and this method will return contacts that pass that block
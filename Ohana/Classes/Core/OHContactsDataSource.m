@@ -25,30 +25,132 @@
 
 #import "OHContactsDataSource.h"
 
+#import <malloc/malloc.h>
+
 CreateSignalImplementation(OHContactsDataSourceReadySignal, NSOrderedSet<OHContact *> *contacts);
+CreateSignalImplementation(OHContactsDataSourcePartialReadySignal, NSOrderedSet<OHContact *> *contacts);
+CreateSignalImplementation(OHContactsDataSourceSnapshotLoadedSignal, NSOrderedSet<OHContact *> *contacts);
+CreateSignalImplementation(OHContactsDataSourceChangedSignal, NSOrderedSet<OHContact *> *contacts, OHContactsDataSourceChange *change);
+CreateSignalImplementation(OHContactsDataSourceMetricsSignal, OHContactsDataSourceMetrics *metrics);
 CreateSignalImplementation(OHContactsDataSourceSelectedContactsSignal, NSSet<OHContact *> *selectedContacts);
 CreateSignalImplementation(OHContactsDataSourceDeselectedContactsSignal, NSSet<OHContact *> *deselectedContacts);
 
+static NSString *const kOHContactsDataSourceLoadStage = @"load";
+static NSString *const kOHContactsDataSourceReprocessStage = @"reprocess";
+static NSString *const kOHContactsDataSourceCombineStage = @"combine";
+
+static NSTimeInterval OHContactsDataSourceCurrentTime(void)
+{
+    return [NSProcessInfo processInfo].systemUptime;
+}
+
+static NSUInteger OHContactsDataSourceAllocationCount(void)
+{
+    malloc_statistics_t statistics;
+    malloc_zone_statistics(NULL, &statistics);
+    return statistics.blocks_in_use;
+}
+
 @interface OHContactsDataSource ()
 
 /**
  *  Read-only public properties
  */
 @property (nonatomic, readwrite) OHContactsDataSourceReadySignal *onContactsDataSourceReadySignal;
+@property (nonatomic, readwrite) OHContactsDataSourcePartialReadySignal *onContactsDataSourcePartialReadySignal;
+@property (nonatomic, readwrite) OHContactsDataSourceSnapshotLoadedSignal *onContactsDataSourceSnapshotLoadedSignal;
+@property (nonatomic, readwrite) OHContactsDataSourceChangedSignal *onContactsDataSourceChangedSignal;
+@property (nonatomic, readwrite) OHContactsDataSourceMetricsSignal *onContactsDataSourceMetricsSignal;
 @property (nonatomic, readwrite) OHContactsDataSourceSelectedContactsSignal *onContactsDataSourceSelectedContactsSignal;
 @property (nonatomic, readwrite) OHContactsDataSourceDeselectedContactsSignal *onContactsDataSourceDeselectedContactsSignal;
 @property (nonatomic, readwrite, nullable) NSOrderedSet<OHContact *> *contacts;
+@property (nonatomic, readwrite, getter=isPartial) BOOL partial;
 @property (nonatomic, readwrite) NSMutableOrderedSet<OHContact *> *selectedContacts;
 
 /**
  *  Used internally to store contacts while processing. Use the contacts property externally.
  */
 @property (nonatomic) NSMutableOrderedSet<OHContact *> *allContacts;
+@property (nonatomic) BOOL allContactsArePartial;
 @property (nonatomic, readwrite) NSOrderedSet<id<OHContactsDataProviderProtocol>> *dataProviders;
 @property (nonatomic, readwrite, nullable) NSOrderedSet<id<OHContactsPostProcessorProtocol>> *postProcessors;
-@property (nonatomic, readwrite) NSMutableSet<id<OHContactsDataProviderProtocol>> *completedDataProviders;
 @property (nonatomic, readwrite) NSMutableSet<id<OHContactsPostProcessorProtocol>> *completedPostProcessors;
 
+/**
+ *  Fan-in barrier for the current load, entered once per data provider and left when that data provider finishes loading
+ */
+@property (nonatomic, nullable) dispatch_group_t loadingGroup;
+
+/**
+ *  Incremented by every call to loadContacts. Processing started for an older generation stops between stages and its result is dropped.
+ */
+@property (nonatomic) NSUInteger loadGeneration;
+@property (nonatomic) NSMutableSet<id<OHContactsDataProviderProtocol>> *pendingDataProviders;
+
+/**
+ *  Generations of the loads each data provider was started in and has not completed yet, oldest first. A data provider that cannot cancel
+ *  may still complete a superseded load, and since loads complete in the order they were started, each completion belongs to the oldest one.
+ */
+@property (nonatomic) NSMapTable<id<OHContactsDataProviderProtocol>, NSMutableArray<NSNumber *> *> *dataProviderLoadGenerations;
+@property (nonatomic) NSMapTable<id<OHContactsDataProviderProtocol>, NSOrderedSet<OHContact *> *> *loadedContacts;
+
+/**
+ *  Contacts received in batches from data providers that have not finished loading yet
+ */
+@property (nonatomic) NSMapTable<id<OHContactsDataProviderProtocol>, NSMutableOrderedSet<OHContact *> *> *streamedContacts;
+@property (nonatomic) BOOL partialProcessingScheduled;
+@property (nonatomic) BOOL finalProcessingStarted;
+
+/**
+ *  Data providers of the current load that failed under OHContactsDataSourceFailurePolicySkip
+ */
+@property (nonatomic) NSMutableSet<id<OHContactsDataProviderProtocol>> *failedDataProviders;
+
+/**
+ *  Set once the readiness deadline of the current load has passed with data providers still loading. The ones that finish afterwards are
+ *  collected in lateDataProviders until a late pass merges their contacts in.
+ */
+@property (nonatomic) BOOL readinessDeadlinePassed;
+@property (nonatomic) NSMutableSet<id<OHContactsDataProviderProtocol>> *lateDataProviders;
+
+/**
+ *  Result of the most recent post processing pass, used as the baseline when computing changes (contacts is only set on the delivery queue)
+ */
+@property (nonatomic, nullable) NSOrderedSet<OHContact *> *processedContacts;
+
+/**
+ *  Output of each post processor stage for the current input generation, used to skip stages whose input and configuration did not change
+ */
+@property (nonatomic) NSUInteger inputGeneration;
+@property (nonatomic) NSUInteger cachedStagesGeneration;
+@property (nonatomic) NSMutableArray<NSString *> *cachedStageFingerprints;
+@property (nonatomic) NSMutableArray<OHContactsIndexVector *> *cachedStageOutputs;
+
+/**
+ *  Metrics of the current load, collected as the data providers finish and reported with the ready signal
+ */
+@property (nonatomic) NSTimeInterval loadStartTime;
+@property (nonatomic) NSUInteger loadStartAllocationCount;
+@property (nonatomic) NSMapTable<id<OHContactsDataProviderProtocol>, NSNumber *> *dataProviderStartTimes;
+@property (nonatomic) NSMapTable<id<OHContactsDataProviderProtocol>, OHContactsDataProviderMetrics *> *dataProviderMetrics;
+
+/**
+ *  Changes reported by the change source that have not been refreshed yet
+ */
+@property (nonatomic) NSMutableSet<NSString *> *pendingChangedContactIdentifiers;
+@property (nonatomic) BOOL pendingChangeIsUnidentified;
+@property (nonatomic) BOOL refreshScheduled;
+
+/**
+ *  Concurrent queue used to load the data providers in OHContactsDataSourceLoadingModeConcurrent
+ */
+@property (nonatomic) dispatch_queue_t dataProviderQueue;
+
+/**
+ *  Serial queue used to run the post processors in OHContactsDataSourceProcessingModeBackground, created lazily with processingQualityOfService
+ */
+@property (nonatomic, nullable) dispatch_queue_t processingQueue;
+
 @end
 
 @implementation OHContactsDataSource
@@ -63,20 +165,41 @@ CreateSignalImplementation(OHContactsDataSourceDeselectedContactsSignal, NSSet<O
         _postProcessors = postProcessors;
 
         _onContactsDataSourceReadySignal = [[OHContactsDataSourceReadySignal alloc] init];
+        _onContactsDataSourcePartialReadySignal = [[OHContactsDataSourcePartialReadySignal alloc] init];
+        _onContactsDataSourceSnapshotLoadedSignal = [[OHContactsDataSourceSnapshotLoadedSignal alloc] init];
+        _onContactsDataSourceChangedSignal = [[OHContactsDataSourceChangedSignal alloc] init];
+        _onContactsDataSourceMetricsSignal = [[OHContactsDataSourceMetricsSignal alloc] init];
         _onContactsDataSourceSelectedContactsSignal = [[OHContactsDataSourceSelectedContactsSignal alloc] init];
         _onContactsDataSourceDeselectedContactsSignal = [[OHContactsDataSourceDeselectedContactsSignal alloc] init];
 
         _allContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
         _selectedContacts = [[NSMutableOrderedSet alloc] init];
 
-
-        _completedDataProviders = [[NSMutableSet<id<OHContactsDataProviderProtocol>> alloc] initWithCapacity:dataProviders.count];
         _completedPostProcessors = [[NSMutableSet<id<OHContactsPostProcessorProtocol>> alloc] initWithCapacity:postProcessors.count];
 
+        _pendingDataProviders = [[NSMutableSet<id<OHContactsDataProviderProtocol>> alloc] initWithCapacity:dataProviders.count];
+        _failedDataProviders = [[NSMutableSet<id<OHContactsDataProviderProtocol>> alloc] init];
+        _lateDataProviders = [[NSMutableSet<id<OHContactsDataProviderProtocol>> alloc] init];
+        _loadedContacts = [NSMapTable strongToStrongObjectsMapTable];
+        _streamedContacts = [NSMapTable strongToStrongObjectsMapTable];
+        _dataProviderLoadGenerations = [NSMapTable strongToStrongObjectsMapTable];
+        _dataProviderQueue = dispatch_queue_create("com.uber.ohana.datasource.dataproviders", DISPATCH_QUEUE_CONCURRENT);
+        _processingQualityOfService = NSQualityOfServiceUserInitiated;
+        _pendingChangedContactIdentifiers = [[NSMutableSet<NSString *> alloc] init];
+        _changeCoalescingInterval = 0.3;
+        _cachedStageFingerprints = [[NSMutableArray<NSString *> alloc] init];
+        _cachedStageOutputs = [[NSMutableArray<OHContactsIndexVector *> alloc] init];
+        _dataProviderStartTimes = [NSMapTable strongToStrongObjectsMapTable];
+        _dataProviderMetrics = [NSMapTable strongToStrongObjectsMapTable];
+
         // Iterate over data providers and subscribe to their onDataProviderFinishedLoadingSignal
         for (id<OHContactsDataProviderProtocol> dataProvider in _dataProviders) {
             // Add onFinishedLoadingSignal observers on each data provider
             [self _setupOnDataProviderFinishedLoadingSignalObserverForDataProvider:dataProvider];
+            [self _setupOnDataProviderErrorSignalObserverForDataProvider:dataProvider];
+            if ([dataProvider respondsToSelector:@selector(onContactsDataProviderBatchLoadedSignal)]) {
+                [self _setupOnDataProviderBatchLoadedSignalObserverForDataProvider:dataProvider];
+            }
         }
     }
     return self;
@@ -92,8 +215,141 @@ CreateSignalImplementation(OHContactsDataSourceDeselectedContactsSignal, NSSet<O
 
 - (void)loadContacts
 {
-    for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
-        [dataProvider loadContacts];
+    [self _traceBeginStage:kOHContactsDataSourceLoadStage];
+    NSTimeInterval loadStartTime = OHContactsDataSourceCurrentTime();
+    NSUInteger loadStartAllocationCount = OHContactsDataSourceAllocationCount();
+
+    dispatch_group_t loadingGroup = dispatch_group_create();
+    dispatch_group_t previousLoadingGroup;
+    NSArray<id<OHContactsDataProviderProtocol>> *previousPendingDataProviders;
+    NSUInteger loadGeneration;
+    @synchronized (self) {
+        previousLoadingGroup = self.loadingGroup;
+        previousPendingDataProviders = self.pendingDataProviders.allObjects;
+        self.loadGeneration++;
+        loadGeneration = self.loadGeneration;
+        self.loadingGroup = loadingGroup;
+        self.loadStartTime = loadStartTime;
+        self.loadStartAllocationCount = loadStartAllocationCount;
+        [self.dataProviderStartTimes removeAllObjects];
+        [self.dataProviderMetrics removeAllObjects];
+        [self.pendingDataProviders removeAllObjects];
+        [self.pendingDataProviders addObjectsFromArray:self.dataProviders.array];
+        [self.loadedContacts removeAllObjects];
+        [self.streamedContacts removeAllObjects];
+        [self.failedDataProviders removeAllObjects];
+        [self.lateDataProviders removeAllObjects];
+        self.finalProcessingStarted = NO;
+        self.readinessDeadlinePassed = NO;
+        for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
+            NSMutableArray<NSNumber *> *loadGenerations = [self.dataProviderLoadGenerations objectForKey:dataProvider];
+            if (!loadGenerations) {
+                loadGenerations = [[NSMutableArray<NSNumber *> alloc] init];
+                [self.dataProviderLoadGenerations setObject:loadGenerations forKey:dataProvider];
+            }
+            // Earlier loads are about to be cancelled, or were never started if the data provider is not processing, for example while it
+            // waits for authorization, and will not complete
+            if ([dataProvider respondsToSelector:@selector(cancelLoading)] || dataProvider.status != OHContactsDataProviderStatusProcessing) {
+                [loadGenerations removeAllObjects];
+            }
+            [loadGenerations addObject:@(loadGeneration)];
+            dispatch_group_enter(loadingGroup);
+        }
+    }
+
+    // Data providers that have not finished the previous load are cancelled before being loaded again, and their share of its barrier is
+    // released since a group cannot be freed while entered. Its notification then finds that its generation has been superseded.
+    for (id<OHContactsDataProviderProtocol> dataProvider in previousPendingDataProviders) {
+        if ([dataProvider respondsToSelector:@selector(cancelLoading)]) {
+            [dataProvider cancelLoading];
+        }
+        dispatch_group_leave(previousLoadingGroup);
+    }
+
+    if (self.readinessDeadline > 0) {
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.readinessDeadline * NSEC_PER_SEC)), self.processingQueue, ^{
+            [self _processLoadedContactsAtReadinessDeadlineForLoadGeneration:loadGeneration];
+        });
+    }
+
+    if (self.snapshotStore && !self.processedContacts) {
+        if (self.processingMode == OHContactsDataSourceProcessingModeBackground) {
+            dispatch_async(self.processingQueue, ^{
+                [self _loadSnapshot];
+            });
+        } else {
+            [self _loadSnapshot];
+        }
+    }
+
+    switch (self.loadingMode) {
+        case OHContactsDataSourceLoadingModeSerial:
+            for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
+                [self _loadDataProvider:dataProvider];
+            }
+            break;
+        case OHContactsDataSourceLoadingModeConcurrent:
+            dispatch_group_notify(loadingGroup, self.processingMode == OHContactsDataSourceProcessingModeBackground ? self.processingQueue : self.dataProviderQueue, ^{
+                [self _processLoadedContactsForLoadGeneration:loadGeneration];
+            });
+            for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
+                dispatch_async(self.dataProviderQueue, ^{
+                    [self _loadDataProvider:dataProvider];
+                });
+            }
+            break;
+    }
+}
+
+- (void)updatePostProcessors:(NSOrderedSet<id<OHContactsPostProcessorProtocol>> *)postProcessors
+{
+    @synchronized (self) {
+        self.postProcessors = postProcessors;
+    }
+    [self reprocessContacts];
+}
+
+- (void)reprocessContacts
+{
+    NSUInteger loadGeneration;
+    @synchronized (self) {
+        if (!self.processedContacts) {
+            return;
+        }
+        loadGeneration = self.loadGeneration;
+    }
+
+    [self _traceBeginStage:kOHContactsDataSourceReprocessStage];
+    NSTimeInterval startTime = OHContactsDataSourceCurrentTime();
+    NSUInteger startAllocationCount = OHContactsDataSourceAllocationCount();
+
+    void (^processingBlock)() = ^{
+        NSOrderedSet<OHContact *> *allContacts;
+        NSUInteger inputGeneration;
+        BOOL partial;
+        @synchronized (self) {
+            allContacts = [self.allContacts copy];
+            inputGeneration = self.inputGeneration;
+            partial = self.allContactsArePartial;
+        }
+
+        NSMutableArray<OHContactsPostProcessorMetrics *> *postProcessorMetrics = [[NSMutableArray<OHContactsPostProcessorMetrics *> alloc] init];
+        NSOrderedSet<OHContact *> *postProcessedContacts = [self _postProcessContacts:allContacts inputGeneration:inputGeneration loadGeneration:loadGeneration postProcessorMetrics:postProcessorMetrics];
+        @synchronized (self) {
+            if (self.loadGeneration != loadGeneration) {
+                // A load started while reprocessing and will deliver its own result
+                return;
+            }
+            self.processedContacts = postProcessedContacts;
+        }
+
+        [self _deliverContacts:postProcessedContacts partial:partial stage:kOHContactsDataSourceReprocessStage startTime:startTime startAllocationCount:startAllocationCount dataProviderMetrics:@[] postProcessorMetrics:postProcessorMetrics combineDuration:0];
+    };
+
+    if (self.processingMode == OHContactsDataSourceProcessingModeBackground) {
+        dispatch_async(self.processingQueue, processingBlock);
+    } else {
+        processingBlock();
     }
 }
 
@@ -146,28 +402,732 @@ CreateSignalImplementation(OHContactsDataSourceDeselectedContactsSignal, NSSet<O
     }
 }
 
+#pragma mark - Properties
+
+- (void)setChangeSource:(id<OHContactsChangeSourceProtocol>)changeSource
+{
+    [_changeSource.onContactsChangeSourceChangedSignal removeObserver:self];
+    _changeSource = changeSource;
+    [changeSource.onContactsChangeSourceChangedSignal addObserver:self callback:^(typeof(self) self, NSSet<NSString *> *contactIdentifiers, id<OHContactsChangeSourceProtocol> changeSource) {
+        [self _scheduleRefreshForContactIdentifiers:contactIdentifiers];
+    }];
+}
+
+- (void)setProcessingQualityOfService:(NSQualityOfService)processingQualityOfService
+{
+    @synchronized (self) {
+        if (_processingQualityOfService != processingQualityOfService) {
+            _processingQualityOfService = processingQualityOfService;
+            _processingQueue = nil;
+        }
+    }
+}
+
+- (dispatch_queue_t)processingQueue
+{
+    @synchronized (self) {
+        if (!_processingQueue) {
+            if (&dispatch_queue_attr_make_with_qos_class != NULL) {
+                dispatch_queue_attr_t attributes = dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, (qos_class_t)self.processingQualityOfService, 0);
+                _processingQueue = dispatch_queue_create("com.uber.ohana.datasource.processing", attributes);
+            } else {
+                // Quality of service classes are iOS 8+, so on iOS 7 target the global queue of the matching priority instead
+                _processingQueue = dispatch_queue_create("com.uber.ohana.datasource.processing", DISPATCH_QUEUE_SERIAL);
+                dispatch_set_target_queue(_processingQueue, dispatch_get_global_queue([[self class] _dispatchQueuePriorityForQualityOfService:self.processingQualityOfService], 0));
+            }
+        }
+        return _processingQueue;
+    }
+}
+
 #pragma mark - Private
 
++ (dispatch_queue_priority_t)_dispatchQueuePriorityForQualityOfService:(NSQualityOfService)qualityOfService
+{
+    switch (qualityOfService) {
+        case NSQualityOfServiceUserInteractive:
+        case NSQualityOfServiceUserInitiated:
+            return DISPATCH_QUEUE_PRIORITY_HIGH;
+        case NSQualityOfServiceUtility:
+            return DISPATCH_QUEUE_PRIORITY_LOW;
+        case NSQualityOfServiceBackground:
+            return DISPATCH_QUEUE_PRIORITY_BACKGROUND;
+        default:
+            return DISPATCH_QUEUE_PRIORITY_DEFAULT;
+    }
+}
+
 - (void)_setupOnDataProviderFinishedLoadingSignalObserverForDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider
 {
     [dataProvider.onContactsDataProviderFinishedLoadingSignal addObserver:self callback:^(typeof(self) self, id<OHContactsDataProviderProtocol> dataProvider) {
-        [self.allContacts unionOrderedSet:dataProvider.contacts];
-        [self.completedDataProviders addObject:dataProvider];
-        if (self.completedDataProviders.count == self.dataProviders.count) {
-
-            if (self.postProcessors.count) {
-                NSOrderedSet *postProcessedContacts = self.allContacts;
-                for (id<OHContactsPostProcessorProtocol> postProcessor in self.postProcessors) {
-                    postProcessedContacts = [postProcessor processContacts:postProcessedContacts];
-                }
-                self.contacts = postProcessedContacts;
-            } else {
-                self.contacts = self.allContacts;
+        [self _completeLoadingOfDataProvider:dataProvider failed:NO];
+    }];
+}
+
+- (void)_setupOnDataProviderErrorSignalObserverForDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider
+{
+    [dataProvider.onContactsDataProviderErrorSignal addObserver:self callback:^(typeof(self) self, NSError *error, id<OHContactsDataProviderProtocol> dataProvider) {
+        if (self.failurePolicy == OHContactsDataSourceFailurePolicySkip) {
+            [self _completeLoadingOfDataProvider:dataProvider failed:YES];
+        }
+    }];
+}
+
+- (void)_completeLoadingOfDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider failed:(BOOL)failed
+{
+    dispatch_group_t loadingGroup;
+    NSUInteger loadGeneration;
+    BOOL scheduleLatePass = NO;
+    BOOL readinessDeadlinePassed;
+    OHContactsDataProviderMetrics *metrics;
+    @synchronized (self) {
+        NSMutableArray<NSNumber *> *loadGenerations = [self.dataProviderLoadGenerations objectForKey:dataProvider];
+        if (loadGenerations.count) {
+            NSUInteger completedLoadGeneration = loadGenerations.firstObject.unsignedIntegerValue;
+            [loadGenerations removeObjectAtIndex:0];
+            if (completedLoadGeneration != self.loadGeneration) {
+                // The result of a superseded load
+                return;
             }
+        }
+        if (![self.pendingDataProviders containsObject:dataProvider]) {
+            // Only the first result from each data provider counts towards the current load
+            return;
+        }
+        [self.pendingDataProviders removeObject:dataProvider];
+        if (failed) {
+            [self.failedDataProviders addObject:dataProvider];
+        } else if (dataProvider.contacts) {
+            [self.loadedContacts setObject:dataProvider.contacts forKey:dataProvider];
+        }
+        [self.streamedContacts removeObjectForKey:dataProvider];
+        loadingGroup = self.loadingGroup;
+        loadGeneration = self.loadGeneration;
+        readinessDeadlinePassed = self.readinessDeadlinePassed;
+        if (readinessDeadlinePassed && !failed) {
+            // Data providers finishing while a late pass is queued are picked up by that pass
+            scheduleLatePass = self.lateDataProviders.count == 0;
+            [self.lateDataProviders addObject:dataProvider];
+        }
 
-            self.onContactsDataSourceReadySignal.fire(self.contacts);
+        NSNumber *startTime = [self.dataProviderStartTimes objectForKey:dataProvider];
+        if (startTime) {
+            NSTimeInterval transformDuration = [dataProvider respondsToSelector:@selector(lastLoadTransformDuration)] ? dataProvider.lastLoadTransformDuration : 0;
+            metrics = [[OHContactsDataProviderMetrics alloc] initWithDataProvider:dataProvider loadDuration:OHContactsDataSourceCurrentTime() - startTime.doubleValue transformDuration:transformDuration contactCount:failed ? 0 : dataProvider.contacts.count];
+            [self.dataProviderMetrics setObject:metrics forKey:dataProvider];
         }
+    }
+    if (metrics) {
+        [self _traceEndStage:[self _stageForObject:dataProvider prefix:@"dataProvider"] duration:metrics.loadDuration];
+    }
+    dispatch_group_leave(loadingGroup);
+
+    if (readinessDeadlinePassed) {
+        if (scheduleLatePass) {
+            dispatch_async(self.processingQueue, ^{
+                [self _mergeLateContactsForLoadGeneration:loadGeneration];
+            });
+        }
+        return;
+    }
+
+    // In concurrent mode the group notification processes the contacts, otherwise process them here once the barrier has been passed
+    if (self.loadingMode == OHContactsDataSourceLoadingModeSerial && dispatch_group_wait(loadingGroup, DISPATCH_TIME_NOW) == 0) {
+        if (self.processingMode == OHContactsDataSourceProcessingModeBackground) {
+            dispatch_async(self.processingQueue, ^{
+                [self _processLoadedContactsForLoadGeneration:loadGeneration];
+            });
+        } else {
+            [self _processLoadedContactsForLoadGeneration:loadGeneration];
+        }
+    }
+}
+
+- (void)_setupOnDataProviderBatchLoadedSignalObserverForDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider
+{
+    [dataProvider.onContactsDataProviderBatchLoadedSignal addObserver:self callback:^(typeof(self) self, NSOrderedSet<OHContact *> *contacts, id<OHContactsDataProviderProtocol> dataProvider) {
+        if (self.processingMode != OHContactsDataSourceProcessingModeBackground) {
+            return;
+        }
+        @synchronized (self) {
+            if (![self.pendingDataProviders containsObject:dataProvider]) {
+                return;
+            }
+            NSMutableOrderedSet<OHContact *> *streamedContacts = [self.streamedContacts objectForKey:dataProvider];
+            if (!streamedContacts) {
+                streamedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
+                [self.streamedContacts setObject:streamedContacts forKey:dataProvider];
+            }
+            [streamedContacts unionOrderedSet:contacts];
+
+            // Batches arriving while a partial pass is queued are picked up by that pass
+            if (self.partialProcessingScheduled) {
+                return;
+            }
+            self.partialProcessingScheduled = YES;
+        }
+        dispatch_async(self.processingQueue, ^{
+            [self _processPartialContacts];
+        });
     }];
 }
 
+- (void)_processPartialContacts
+{
+    NSMapTable<id<OHContactsDataProviderProtocol>, NSOrderedSet<OHContact *> *> *partialContactsByDataProvider = [NSMapTable strongToStrongObjectsMapTable];
+    NSUInteger loadGeneration;
+    NSUInteger inputGeneration;
+    @synchronized (self) {
+        self.partialProcessingScheduled = NO;
+        if (self.finalProcessingStarted) {
+            return;
+        }
+        loadGeneration = self.loadGeneration;
+        // The partial input gets a generation of its own and allContacts a new one after it, so stages cached for the partial input are
+        // never reused for allContacts
+        self.inputGeneration++;
+        inputGeneration = self.inputGeneration;
+        self.inputGeneration++;
+        for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
+            NSOrderedSet<OHContact *> *contacts = [self.loadedContacts objectForKey:dataProvider] ?: [[self.streamedContacts objectForKey:dataProvider] copy];
+            if (contacts) {
+                [partialContactsByDataProvider setObject:contacts forKey:dataProvider];
+            }
+        }
+    }
+
+    NSOrderedSet<OHContact *> *partialContacts = [self _combinedContactsByDataProvider:partialContactsByDataProvider];
+    NSOrderedSet<OHContact *> *postProcessedContacts = [self _postProcessContacts:partialContacts inputGeneration:inputGeneration loadGeneration:loadGeneration postProcessorMetrics:nil];
+    if (!postProcessedContacts) {
+        return;
+    }
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration || self.finalProcessingStarted) {
+            return;
+        }
+    }
+
+    void (^deliveryBlock)() = ^{
+        self.onContactsDataSourcePartialReadySignal.fire(postProcessedContacts);
+    };
+
+    if (self.deliveryQueue) {
+        dispatch_async(self.deliveryQueue, deliveryBlock);
+    } else {
+        deliveryBlock();
+    }
+}
+
+- (void)_processLoadedContactsForLoadGeneration:(NSUInteger)loadGeneration
+{
+    NSMapTable<id<OHContactsDataProviderProtocol>, NSOrderedSet<OHContact *> *> *loadedContacts;
+    NSTimeInterval loadStartTime;
+    NSUInteger loadStartAllocationCount;
+    BOOL partial;
+    NSMutableArray<OHContactsDataProviderMetrics *> *dataProviderMetrics = [[NSMutableArray<OHContactsDataProviderMetrics *> alloc] initWithCapacity:self.dataProviders.count];
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration || self.finalProcessingStarted) {
+            // Superseded, or already processed at the readiness deadline
+            return;
+        }
+        self.finalProcessingStarted = YES;
+        loadedContacts = [self.loadedContacts copy];
+        partial = self.pendingDataProviders.count || self.failedDataProviders.count;
+        loadStartTime = self.loadStartTime;
+        loadStartAllocationCount = self.loadStartAllocationCount;
+        for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
+            OHContactsDataProviderMetrics *metrics = [self.dataProviderMetrics objectForKey:dataProvider];
+            if (metrics) {
+                [dataProviderMetrics addObject:metrics];
+            }
+        }
+    }
+
+    [self _traceBeginStage:kOHContactsDataSourceCombineStage];
+    NSTimeInterval combineStartTime = OHContactsDataSourceCurrentTime();
+    NSMutableOrderedSet<OHContact *> *allContacts = [self _combinedContactsByDataProvider:loadedContacts];
+    NSTimeInterval combineDuration = OHContactsDataSourceCurrentTime() - combineStartTime;
+    [self _traceEndStage:kOHContactsDataSourceCombineStage duration:combineDuration];
+
+    NSUInteger inputGeneration;
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration) {
+            return;
+        }
+        self.allContacts = allContacts;
+        self.allContactsArePartial = partial;
+        self.inputGeneration++;
+        inputGeneration = self.inputGeneration;
+    }
+
+    NSMutableArray<OHContactsPostProcessorMetrics *> *postProcessorMetrics = [[NSMutableArray<OHContactsPostProcessorMetrics *> alloc] init];
+    NSOrderedSet<OHContact *> *postProcessedContacts = [self _postProcessContacts:allContacts inputGeneration:inputGeneration loadGeneration:loadGeneration postProcessorMetrics:postProcessorMetrics];
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration) {
+            return;
+        }
+        self.processedContacts = postProcessedContacts;
+    }
+
+    [self _deliverContacts:postProcessedContacts partial:partial stage:kOHContactsDataSourceLoadStage startTime:loadStartTime startAllocationCount:loadStartAllocationCount dataProviderMetrics:dataProviderMetrics postProcessorMetrics:postProcessorMetrics combineDuration:combineDuration];
+}
+
+- (void)_processLoadedContactsAtReadinessDeadlineForLoadGeneration:(NSUInteger)loadGeneration
+{
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration || self.finalProcessingStarted || !self.pendingDataProviders.count) {
+            return;
+        }
+        // From here on the remaining data providers are merged in by late passes, which are queued behind this one
+        self.readinessDeadlinePassed = YES;
+    }
+    [self _processLoadedContactsForLoadGeneration:loadGeneration];
+}
+
+/**
+ *  Merges the contacts of the data providers that finished after the readiness deadline into the delivered result
+ */
+- (void)_mergeLateContactsForLoadGeneration:(NSUInteger)loadGeneration
+{
+    NSOrderedSet<OHContact *> *previousContacts;
+    NSMapTable<id<OHContactsDataProviderProtocol>, NSOrderedSet<OHContact *> *> *loadedContacts;
+    NSSet<id<OHContactsDataProviderProtocol>> *lateDataProviders;
+    BOOL partial;
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration || !self.processedContacts) {
+            return;
+        }
+        previousContacts = self.processedContacts;
+        loadedContacts = [self.loadedContacts copy];
+        lateDataProviders = [self.lateDataProviders copy];
+        [self.lateDataProviders removeAllObjects];
+        partial = self.pendingDataProviders.count || self.failedDataProviders.count;
+    }
+
+    NSMutableSet<NSString *> *lateContactIdentifiers = [[NSMutableSet<NSString *> alloc] init];
+    for (id<OHContactsDataProviderProtocol> dataProvider in lateDataProviders) {
+        if (![dataProvider respondsToSelector:@selector(contactIdentifierForContact:)]) {
+            continue;
+        }
+        for (OHContact *contact in [loadedContacts objectForKey:dataProvider]) {
+            NSString *contactIdentifier = [dataProvider contactIdentifierForContact:contact];
+            if (contactIdentifier) {
+                [lateContactIdentifiers addObject:contactIdentifier];
+            }
+        }
+    }
+
+    NSMutableOrderedSet<OHContact *> *allContacts = [self _combinedContactsByDataProvider:loadedContacts];
+    NSUInteger inputGeneration;
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration) {
+            return;
+        }
+        self.allContacts = allContacts;
+        self.allContactsArePartial = partial;
+        self.inputGeneration++;
+        inputGeneration = self.inputGeneration;
+    }
+    NSOrderedSet<OHContact *> *postProcessedContacts = [self _postProcessContacts:allContacts inputGeneration:inputGeneration loadGeneration:loadGeneration postProcessorMetrics:nil];
+    if (!postProcessedContacts) {
+        return;
+    }
+    OHContactsDataSourceChange *change = [OHContactsDataSourceChange changeFromContacts:previousContacts toContacts:postProcessedContacts keyBlock:^id<NSCopying>(OHContact *contact) {
+        return [self _contactIdentifierForContact:contact] ?: [NSValue valueWithNonretainedObject:contact];
+    } updatedKeys:[self _updatedKeysForContacts:postProcessedContacts updatedContactIdentifiers:lateContactIdentifiers]];
+
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration) {
+            return;
+        }
+        self.processedContacts = postProcessedContacts;
+    }
+
+    [self _deliverChangedContacts:postProcessedContacts partial:partial change:change];
+}
+
+/**
+ *  Unions the contacts in data provider order so the result does not depend on which data provider finished first, or merges them if a
+ *  contacts merger is set
+ */
+- (NSMutableOrderedSet<OHContact *> *)_combinedContactsByDataProvider:(NSMapTable<id<OHContactsDataProviderProtocol>, NSOrderedSet<OHContact *> *> *)contactsByDataProvider
+{
+    if (self.contactsMerger) {
+        return [[self.contactsMerger mergeContactsByDataProvider:contactsByDataProvider dataProviders:self.dataProviders] mutableCopy];
+    }
+
+    NSMutableOrderedSet<OHContact *> *combinedContacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
+    for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
+        NSOrderedSet<OHContact *> *contacts = [contactsByDataProvider objectForKey:dataProvider];
+        if (contacts) {
+            [combinedContacts unionOrderedSet:contacts];
+        }
+    }
+    return combinedContacts;
+}
+
+/**
+ *  Runs the post processors, reusing the cached output of every leading stage whose fingerprint matches the one it was cached with, and
+ *  appends the metrics of each stage to postProcessorMetrics
+ *
+ *  @discussion Stages pass an index vector along, so only stages that do not conform to OHContactsIndexVectorPostProcessorProtocol and the final
+ *  result build an ordered set. Stops between stages and returns nil once loadGeneration has been superseded by a new load.
+ */
+- (nullable NSOrderedSet<OHContact *> *)_postProcessContacts:(NSOrderedSet<OHContact *> *)contacts inputGeneration:(NSUInteger)inputGeneration loadGeneration:(NSUInteger)loadGeneration postProcessorMetrics:(NSMutableArray<OHContactsPostProcessorMetrics *> *_Nullable)postProcessorMetrics
+{
+    NSOrderedSet<id<OHContactsPostProcessorProtocol>> *postProcessors;
+    NSArray<NSString *> *cachedStageFingerprints;
+    NSArray<OHContactsIndexVector *> *cachedStageOutputs;
+    @synchronized (self) {
+        postProcessors = self.postProcessors;
+        if (self.cachedStagesGeneration != inputGeneration) {
+            [self.cachedStageFingerprints removeAllObjects];
+            [self.cachedStageOutputs removeAllObjects];
+            self.cachedStagesGeneration = inputGeneration;
+        }
+        cachedStageFingerprints = [self.cachedStageFingerprints copy];
+        cachedStageOutputs = [self.cachedStageOutputs copy];
+    }
+
+    NSMutableArray<NSString *> *stageFingerprints = [[NSMutableArray<NSString *> alloc] initWithCapacity:postProcessors.count];
+    NSMutableArray<OHContactsIndexVector *> *stageOutputs = [[NSMutableArray<OHContactsIndexVector *> alloc] initWithCapacity:postProcessors.count];
+    BOOL reusingStages = YES;
+    OHContactsIndexVector *indexVector = [[OHContactsIndexVector alloc] initWithContacts:contacts];
+    for (NSUInteger stage = 0; stage < postProcessors.count; stage++) {
+        id<OHContactsPostProcessorProtocol> postProcessor = [postProcessors objectAtIndex:stage];
+        NSString *fingerprint = [postProcessor respondsToSelector:@selector(configurationFingerprint)] ? [postProcessor configurationFingerprint] : nil;
+        if (!fingerprint) {
+            // Stages without a fingerprint always run, and so does every stage after them
+            reusingStages = NO;
+        } else if (reusingStages && stage < cachedStageFingerprints.count && [[cachedStageFingerprints objectAtIndex:stage] isEqualToString:fingerprint]) {
+            NSUInteger inputCount = indexVector.count;
+            indexVector = [cachedStageOutputs objectAtIndex:stage];
+            [stageFingerprints addObject:fingerprint];
+            [stageOutputs addObject:indexVector];
+            [postProcessorMetrics addObject:[[OHContactsPostProcessorMetrics alloc] initWithPostProcessor:postProcessor duration:0 inputCount:inputCount outputCount:indexVector.count reused:YES]];
+            continue;
+        }
+        reusingStages = NO;
+
+        @synchronized (self) {
+            if (self.loadGeneration != loadGeneration) {
+                return nil;
+            }
+        }
+
+        NSString *traceStage = [self _stageForObject:postProcessor prefix:@"postProcessor"];
+        NSUInteger inputCount = indexVector.count;
+        [self _traceBeginStage:traceStage];
+        NSTimeInterval startTime = OHContactsDataSourceCurrentTime();
+        indexVector = [indexVector indexVectorProcessedByPostProcessor:postProcessor];
+        NSTimeInterval duration = OHContactsDataSourceCurrentTime() - startTime;
+        [self _traceEndStage:traceStage duration:duration];
+        [postProcessorMetrics addObject:[[OHContactsPostProcessorMetrics alloc] initWithPostProcessor:postProcessor duration:duration inputCount:inputCount outputCount:indexVector.count reused:NO]];
+        // Only a contiguous run of leading stages can be reused
+        if (fingerprint && stageFingerprints.count == stage) {
+            [stageFingerprints addObject:fingerprint];
+            [stageOutputs addObject:indexVector];
+        }
+    }
+
+    @synchronized (self) {
+        if (self.cachedStagesGeneration == inputGeneration) {
+            [self.cachedStageFingerprints setArray:stageFingerprints];
+            [self.cachedStageOutputs setArray:stageOutputs];
+        }
+    }
+    return [indexVector contacts];
+}
+
+- (void)_loadSnapshot
+{
+    NSOrderedSet<OHContact *> *snapshotContacts = [self.snapshotStore readContactsWithError:nil];
+    if (!snapshotContacts) {
+        return;
+    }
+
+    void (^deliveryBlock)() = ^{
+        // The live result is delivered on the same queue, so a nil contacts property means it has not been delivered yet
+        if (self.contacts) {
+            return;
+        }
+        self.contacts = snapshotContacts;
+        self.onContactsDataSourceSnapshotLoadedSignal.fire(snapshotContacts);
+    };
+
+    if (self.deliveryQueue) {
+        dispatch_async(self.deliveryQueue, deliveryBlock);
+    } else {
+        deliveryBlock();
+    }
+}
+
+/**
+ *  Partial results are not written, so that the next cold start does not show a data provider's contacts as missing
+ */
+- (void)_writeSnapshotOfContacts:(NSOrderedSet<OHContact *> *)contacts partial:(BOOL)partial
+{
+    if (contacts && !partial) {
+        [self.snapshotStore writeContacts:contacts completion:nil];
+    }
+}
+
+- (void)_deliverContacts:(NSOrderedSet<OHContact *> *)contacts partial:(BOOL)partial stage:(NSString *)stage startTime:(NSTimeInterval)startTime startAllocationCount:(NSUInteger)startAllocationCount dataProviderMetrics:(NSArray<OHContactsDataProviderMetrics *> *)dataProviderMetrics postProcessorMetrics:(NSArray<OHContactsPostProcessorMetrics *> *)postProcessorMetrics combineDuration:(NSTimeInterval)combineDuration
+{
+    void (^deliveryBlock)() = ^{
+        NSTimeInterval readyDuration = OHContactsDataSourceCurrentTime() - startTime;
+        NSInteger allocationCount = (NSInteger)OHContactsDataSourceAllocationCount() - (NSInteger)startAllocationCount;
+
+        self.contacts = contacts;
+        self.partial = partial;
+        self.onContactsDataSourceReadySignal.fire(contacts);
+        [self _traceEndStage:stage duration:readyDuration];
+
+        OHContactsDataSourceMetrics *metrics = [[OHContactsDataSourceMetrics alloc] initWithDataProviderMetrics:dataProviderMetrics postProcessorMetrics:postProcessorMetrics combineDuration:combineDuration readyDuration:readyDuration approximateAllocationCount:allocationCount];
+        self.onContactsDataSourceMetricsSignal.fire(metrics);
+        id<OHContactsDataSourceTracingProtocol> tracer = self.tracer;
+        if ([tracer respondsToSelector:@selector(contactsDataSource:didCollectMetrics:)]) {
+            [tracer contactsDataSource:self didCollectMetrics:metrics];
+        }
+    };
+
+    // The snapshot store copies the contacts before they are handed to another queue, where observers may modify them
+    if (self.deliveryQueue) {
+        [self _writeSnapshotOfContacts:contacts partial:partial];
+        dispatch_async(self.deliveryQueue, deliveryBlock);
+    } else {
+        deliveryBlock();
+        [self _writeSnapshotOfContacts:contacts partial:partial];
+    }
+}
+
+- (void)_deliverChangedContacts:(NSOrderedSet<OHContact *> *)contacts partial:(BOOL)partial change:(OHContactsDataSourceChange *)change
+{
+    void (^deliveryBlock)() = ^{
+        self.contacts = contacts;
+        self.partial = partial;
+        self.onContactsDataSourceChangedSignal.fire(contacts, change);
+    };
+
+    if (self.deliveryQueue) {
+        [self _writeSnapshotOfContacts:contacts partial:partial];
+        dispatch_async(self.deliveryQueue, deliveryBlock);
+    } else {
+        deliveryBlock();
+        [self _writeSnapshotOfContacts:contacts partial:partial];
+    }
+}
+
+#pragma mark - Private - Tracing
+
+- (void)_loadDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider
+{
+    [self _traceBeginStage:[self _stageForObject:dataProvider prefix:@"dataProvider"]];
+    @synchronized (self) {
+        [self.dataProviderStartTimes setObject:@(OHContactsDataSourceCurrentTime()) forKey:dataProvider];
+    }
+    [dataProvider loadContacts];
+}
+
+- (NSString *)_stageForObject:(id)object prefix:(NSString *)prefix
+{
+    return [NSString stringWithFormat:@"%@.%@", prefix, NSStringFromClass([object class])];
+}
+
+- (void)_traceBeginStage:(NSString *)stage
+{
+    id<OHContactsDataSourceTracingProtocol> tracer = self.tracer;
+    if ([tracer respondsToSelector:@selector(contactsDataSource:didBeginStage:)]) {
+        [tracer contactsDataSource:self didBeginStage:stage];
+    }
+}
+
+- (void)_traceEndStage:(NSString *)stage duration:(NSTimeInterval)duration
+{
+    id<OHContactsDataSourceTracingProtocol> tracer = self.tracer;
+    if ([tracer respondsToSelector:@selector(contactsDataSource:didEndStage:duration:)]) {
+        [tracer contactsDataSource:self didEndStage:stage duration:duration];
+    }
+}
+
+#pragma mark - Private - Refreshing
+
+- (void)_scheduleRefreshForContactIdentifiers:(NSSet<NSString *> *)contactIdentifiers
+{
+    @synchronized (self) {
+        if (contactIdentifiers) {
+            [self.pendingChangedContactIdentifiers unionSet:contactIdentifiers];
+        } else {
+            self.pendingChangeIsUnidentified = YES;
+        }
+        if (self.refreshScheduled) {
+            return;
+        }
+        self.refreshScheduled = YES;
+    }
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.changeCoalescingInterval * NSEC_PER_SEC)), self.processingQueue, ^{
+        [self _refreshChangedContacts];
+    });
+}
+
+- (void)_refreshChangedContacts
+{
+    NSSet<NSString *> *changedContactIdentifiers;
+    NSOrderedSet<OHContact *> *previousContacts;
+    NSMapTable<id<OHContactsDataProviderProtocol>, NSOrderedSet<OHContact *> *> *loadedContacts;
+    NSUInteger loadGeneration;
+    @synchronized (self) {
+        changedContactIdentifiers = self.pendingChangeIsUnidentified ? nil : [self.pendingChangedContactIdentifiers copy];
+        [self.pendingChangedContactIdentifiers removeAllObjects];
+        self.pendingChangeIsUnidentified = NO;
+        self.refreshScheduled = NO;
+
+        if (!self.processedContacts || self.pendingDataProviders.count) {
+            // Nothing has been loaded yet, or a load is in flight and will pick up the changes
+            return;
+        }
+        previousContacts = self.processedContacts;
+        loadedContacts = [self.loadedContacts copy];
+        loadGeneration = self.loadGeneration;
+    }
+
+    NSMutableSet<NSString *> *updatedContactIdentifiers = [[NSMutableSet<NSString *> alloc] init];
+    for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
+        if (![dataProvider respondsToSelector:@selector(fetchContactsWithIdentifiers:error:)] || ![dataProvider respondsToSelector:@selector(contactIdentifierForContact:)]) {
+            continue;
+        }
+        NSOrderedSet<OHContact *> *fetchedContacts = [dataProvider fetchContactsWithIdentifiers:changedContactIdentifiers error:nil];
+        if (fetchedContacts) {
+            NSMutableOrderedSet<OHContact *> *contacts = [[loadedContacts objectForKey:dataProvider] mutableCopy] ?: [[NSMutableOrderedSet<OHContact *> alloc] init];
+            [self _patchContacts:contacts withFetchedContacts:fetchedContacts fromDataProvider:dataProvider changedContactIdentifiers:changedContactIdentifiers updatedContactIdentifiers:updatedContactIdentifiers];
+            [loadedContacts setObject:contacts forKey:dataProvider];
+        }
+    }
+
+    if (!updatedContactIdentifiers.count) {
+        return;
+    }
+
+    NSMutableOrderedSet<OHContact *> *allContacts = [self _combinedContactsByDataProvider:loadedContacts];
+    NSUInteger inputGeneration;
+    BOOL partial;
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration) {
+            // A load started while refreshing and supersedes this refresh
+            return;
+        }
+        partial = self.failedDataProviders.count > 0;
+        self.loadedContacts = loadedContacts;
+        self.allContacts = allContacts;
+        self.allContactsArePartial = partial;
+        self.inputGeneration++;
+        inputGeneration = self.inputGeneration;
+    }
+    NSOrderedSet<OHContact *> *postProcessedContacts = [self _postProcessContacts:allContacts inputGeneration:inputGeneration loadGeneration:loadGeneration postProcessorMetrics:nil];
+    if (!postProcessedContacts) {
+        return;
+    }
+    OHContactsDataSourceChange *change = [OHContactsDataSourceChange changeFromContacts:previousContacts toContacts:postProcessedContacts keyBlock:^id<NSCopying>(OHContact *contact) {
+        return [self _contactIdentifierForContact:contact] ?: [NSValue valueWithNonretainedObject:contact];
+    } updatedKeys:[self _updatedKeysForContacts:postProcessedContacts updatedContactIdentifiers:updatedContactIdentifiers]];
+
+    @synchronized (self) {
+        if (self.loadGeneration != loadGeneration) {
+            return;
+        }
+        self.processedContacts = postProcessedContacts;
+    }
+
+    [self _deliverChangedContacts:postProcessedContacts partial:partial change:change];
+}
+
+/**
+ *  Replaces, removes and appends the contacts of one data provider in place, collecting the identifiers of every contact that changed
+ */
+- (void)_patchContacts:(NSMutableOrderedSet<OHContact *> *)contacts withFetchedContacts:(NSOrderedSet<OHContact *> *)fetchedContacts fromDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider changedContactIdentifiers:(NSSet<NSString *> *_Nullable)changedContactIdentifiers updatedContactIdentifiers:(NSMutableSet<NSString *> *)updatedContactIdentifiers
+{
+    NSMutableDictionary<NSString *, OHContact *> *unmatchedFetchedContacts = [[NSMutableDictionary alloc] initWithCapacity:fetchedContacts.count];
+    for (OHContact *fetchedContact in fetchedContacts) {
+        NSString *contactIdentifier = [dataProvider contactIdentifierForContact:fetchedContact];
+        if (contactIdentifier) {
+            [unmatchedFetchedContacts setObject:fetchedContact forKey:contactIdentifier];
+        }
+    }
+
+    NSMutableIndexSet *removedIndexes = [[NSMutableIndexSet alloc] init];
+    for (NSUInteger i = 0; i < contacts.count; i++) {
+        OHContact *contact = [contacts objectAtIndex:i];
+        NSString *contactIdentifier = [dataProvider contactIdentifierForContact:contact];
+        if (!contactIdentifier || (changedContactIdentifiers && ![changedContactIdentifiers containsObject:contactIdentifier])) {
+            continue;
+        }
+
+        OHContact *fetchedContact = [unmatchedFetchedContacts objectForKey:contactIdentifier];
+        [unmatchedFetchedContacts removeObjectForKey:contactIdentifier];
+        if (!fetchedContact) {
+            [removedIndexes addIndex:i];
+            [updatedContactIdentifiers addObject:contactIdentifier];
+        } else if (![self _contact:contact hasSameStoreDataAsContact:fetchedContact]) {
+            [contacts replaceObjectAtIndex:i withObject:fetchedContact];
+            [updatedContactIdentifiers addObject:contactIdentifier];
+        }
+    }
+    [contacts removeObjectsAtIndexes:removedIndexes];
+
+    // Fetched contacts that did not match an existing contact are new to the store
+    for (OHContact *fetchedContact in fetchedContacts) {
+        NSString *contactIdentifier = [dataProvider contactIdentifierForContact:fetchedContact];
+        if (contactIdentifier && [unmatchedFetchedContacts objectForKey:contactIdentifier]) {
+            [contacts addObject:fetchedContact];
+            [updatedContactIdentifiers addObject:contactIdentifier];
+        }
+    }
+}
+
+/**
+ *  Adds the keys of merged contacts built from an updated contact, since a merged contact may be keyed by another source contact's identifier
+ */
+- (NSSet *)_updatedKeysForContacts:(NSOrderedSet<OHContact *> *)contacts updatedContactIdentifiers:(NSSet<NSString *> *)updatedContactIdentifiers
+{
+    if (!self.contactsMerger) {
+        return updatedContactIdentifiers;
+    }
+
+    NSMutableSet *updatedKeys = [updatedContactIdentifiers mutableCopy];
+    for (OHContact *contact in contacts) {
+        for (OHContact *sourceContact in [contact.customProperties objectForKey:kOHContactsMergerSourceContactsKey]) {
+            NSString *sourceContactIdentifier = [self _contactIdentifierForContact:sourceContact];
+            if (sourceContactIdentifier && [updatedContactIdentifiers containsObject:sourceContactIdentifier]) {
+                NSString *contactIdentifier = [self _contactIdentifierForContact:contact];
+                if (contactIdentifier) {
+                    [updatedKeys addObject:contactIdentifier];
+                }
+                break;
+            }
+        }
+    }
+    return updatedKeys;
+}
+
+- (NSString *)_contactIdentifierForContact:(OHContact *)contact
+{
+    for (id<OHContactsDataProviderProtocol> dataProvider in self.dataProviders) {
+        if ([dataProvider respondsToSelector:@selector(contactIdentifierForContact:)]) {
+            NSString *contactIdentifier = [dataProvider contactIdentifierForContact:contact];
+            if (contactIdentifier) {
+                return contactIdentifier;
+            }
+        }
+    }
+    return nil;
+}
+
+/**
+ *  Compares the data a data provider loads from the store, ignoring tags and custom properties which post processors may have added
+ */
+- (BOOL)_contact:(OHContact *)contact hasSameStoreDataAsContact:(OHContact *)otherContact
+{
+    return contact.contentFingerprint == otherContact.contentFingerprint;
+}
+
 @end
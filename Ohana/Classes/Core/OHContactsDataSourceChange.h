@@ -0,0 +1,86 @@
+//
+//  OHContactsDataSourceChange.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "OHContact.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Block returning the key used to match a contact across two versions of the data source's contacts
+ */
+typedef id<NSCopying> _Nonnull (^OHContactsDataSourceChangeKeyBlock)(OHContact *contact);
+
+@interface OHContactsDataSourceChange : NSObject
+
+/**
+ *  Creates the change object
+ */
+- (instancetype)initWithRemovedIndexes:(NSIndexSet *)removedIndexes insertedIndexes:(NSIndexSet *)insertedIndexes updatedIndexes:(NSIndexSet *)updatedIndexes movedIndexes:(NSDictionary<NSNumber *, NSNumber *> *)movedIndexes NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Computes the change between two versions of the data source's contacts
+ *
+ *  @discussion Contacts are matched by the key returned from keyBlock. When several contacts share a key (for example contacts split on a
+ *  field type), they are matched by their order of appearance. Moves are only reported for contacts whose relative order changed.
+ *
+ *  @param previousContacts The contacts before the change
+ *  @param contacts         The contacts after the change
+ *  @param keyBlock         Block returning the matching key of a contact
+ *  @param updatedKeys      Keys of contacts whose data changed
+ */
++ (instancetype)changeFromContacts:(NSOrderedSet<OHContact *> *)previousContacts toContacts:(NSOrderedSet<OHContact *> *)contacts keyBlock:(OHContactsDataSourceChangeKeyBlock)keyBlock updatedKeys:(NSSet *)updatedKeys;
+
+/**
+ *  Indexes in the previous contacts of contacts that were removed
+ */
+@property (nonatomic, readonly) NSIndexSet *removedIndexes;
+
+/**
+ *  Indexes in the new contacts of contacts that were inserted
+ */
+@property (nonatomic, readonly) NSIndexSet *insertedIndexes;
+
+/**
+ *  Indexes in the previous contacts of contacts whose data changed
+ */
+@property (nonatomic, readonly) NSIndexSet *updatedIndexes;
+
+/**
+ *  Map from index in the previous contacts to index in the new contacts for contacts that moved
+ */
+@property (nonatomic, readonly) NSDictionary<NSNumber *, NSNumber *> *movedIndexes;
+
+/**
+ *  Whether the change contains any removals, insertions, updates or moves
+ */
+@property (nonatomic, readonly) BOOL hasChanges;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,150 @@
+//
+//  OHContactsDataSourceChange.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHContactsDataSourceChange.h"
+
+/**
+ *  Marks the elements of values that belong to one of its longest strictly increasing subsequences (patience sorting, O(n log n))
+ */
+static void OHMarkLongestIncreasingSubsequence(const NSUInteger *values, NSUInteger count, BOOL *mask)
+{
+    if (!count) {
+        return;
+    }
+    NSUInteger *tails = malloc(count * sizeof(NSUInteger));
+    NSUInteger *predecessors = malloc(count * sizeof(NSUInteger));
+    NSUInteger length = 0;
+    for (NSUInteger i = 0; i < count; i++) {
+        NSUInteger low = 0;
+        NSUInteger high = length;
+        while (low < high) {
+            NSUInteger mid = (low + high) / 2;
+            if (values[tails[mid]] < values[i]) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        predecessors[i] = low > 0 ? tails[low - 1] : NSNotFound;
+        tails[low] = i;
+        if (low == length) {
+            length++;
+        }
+    }
+    for (NSUInteger i = tails[length - 1]; i != NSNotFound; i = predecessors[i]) {
+        mask[i] = YES;
+    }
+    free(tails);
+    free(predecessors);
+}
+
+@implementation OHContactsDataSourceChange
+
+- (instancetype)initWithRemovedIndexes:(NSIndexSet *)removedIndexes insertedIndexes:(NSIndexSet *)insertedIndexes updatedIndexes:(NSIndexSet *)updatedIndexes movedIndexes:(NSDictionary<NSNumber *, NSNumber *> *)movedIndexes
+{
+    if (self = [super init]) {
+        _removedIndexes = [removedIndexes copy];
+        _insertedIndexes = [insertedIndexes copy];
+        _updatedIndexes = [updatedIndexes copy];
+        _movedIndexes = [movedIndexes copy];
+    }
+    return self;
+}
+
++ (instancetype)changeFromContacts:(NSOrderedSet<OHContact *> *)previousContacts toContacts:(NSOrderedSet<OHContact *> *)contacts keyBlock:(OHContactsDataSourceChangeKeyBlock)keyBlock updatedKeys:(NSSet *)updatedKeys
+{
+    NSArray<NSArray *> *previousKeys = [self _occurrenceKeysForContacts:previousContacts keyBlock:keyBlock];
+    NSArray<NSArray *> *keys = [self _occurrenceKeysForContacts:contacts keyBlock:keyBlock];
+
+    NSMutableDictionary<NSArray *, NSNumber *> *indexForKey = [[NSMutableDictionary alloc] initWithCapacity:keys.count];
+    [keys enumerateObjectsUsingBlock:^(NSArray *key, NSUInteger index, BOOL *stop) {
+        [indexForKey setObject:@(index) forKey:key];
+    }];
+    NSSet<NSArray *> *previousKeySet = [NSSet setWithArray:previousKeys];
+
+    NSMutableIndexSet *removedIndexes = [[NSMutableIndexSet alloc] init];
+    NSMutableIndexSet *insertedIndexes = [[NSMutableIndexSet alloc] init];
+    NSMutableIndexSet *updatedIndexes = [[NSMutableIndexSet alloc] init];
+    NSMutableDictionary<NSNumber *, NSNumber *> *movedIndexes = [[NSMutableDictionary alloc] init];
+
+    NSUInteger commonCount = 0;
+    NSUInteger *commonPreviousIndexes = malloc(MAX(previousKeys.count, 1) * sizeof(NSUInteger));
+    NSUInteger *commonIndexes = malloc(MAX(previousKeys.count, 1) * sizeof(NSUInteger));
+    for (NSUInteger i = 0; i < previousKeys.count; i++) {
+        NSArray *key = [previousKeys objectAtIndex:i];
+        NSNumber *index = [indexForKey objectForKey:key];
+        if (!index) {
+            [removedIndexes addIndex:i];
+            continue;
+        }
+        if ([updatedKeys containsObject:key.firstObject]) {
+            [updatedIndexes addIndex:i];
+        }
+        commonPreviousIndexes[commonCount] = i;
+        commonIndexes[commonCount] = index.unsignedIntegerValue;
+        commonCount++;
+    }
+    for (NSUInteger i = 0; i < keys.count; i++) {
+        if (![previousKeySet containsObject:[keys objectAtIndex:i]]) {
+            [insertedIndexes addIndex:i];
+        }
+    }
+
+    // Contacts on the longest run that kept its relative order stay in place, every other common contact moved
+    BOOL *inOrder = calloc(MAX(commonCount, 1), sizeof(BOOL));
+    OHMarkLongestIncreasingSubsequence(commonIndexes, commonCount, inOrder);
+    for (NSUInteger i = 0; i < commonCount; i++) {
+        if (!inOrder[i]) {
+            [movedIndexes setObject:@(commonIndexes[i]) forKey:@(commonPreviousIndexes[i])];
+        }
+    }
+    free(inOrder);
+    free(commonPreviousIndexes);
+    free(commonIndexes);
+
+    return [[self alloc] initWithRemovedIndexes:removedIndexes insertedIndexes:insertedIndexes updatedIndexes:updatedIndexes movedIndexes:movedIndexes];
+}
+
+- (BOOL)hasChanges
+{
+    return self.removedIndexes.count || self.insertedIndexes.count || self.updatedIndexes.count || self.movedIndexes.count;
+}
+
+#pragma mark - Private
+
++ (NSArray<NSArray *> *)_occurrenceKeysForContacts:(NSOrderedSet<OHContact *> *)contacts keyBlock:(OHContactsDataSourceChangeKeyBlock)keyBlock
+{
+    NSMutableArray<NSArray *> *occurrenceKeys = [[NSMutableArray alloc] initWithCapacity:contacts.count];
+    NSMutableDictionary<id<NSCopying>, NSNumber *> *occurrences = [[NSMutableDictionary alloc] initWithCapacity:contacts.count];
+    for (OHContact *contact in contacts) {
+        id<NSCopying> key = keyBlock(contact);
+        NSUInteger occurrence = [[occurrences objectForKey:key] unsignedIntegerValue];
+        [occurrences setObject:@(occurrence + 1) forKey:key];
+        [occurrenceKeys addObject:@[key, @(occurrence)]];
+    }
+    return occurrenceKeys;
+}
+
+@end
@@ -0,0 +1,130 @@
+//
+//  OHContactsDataSourceMetrics.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <Foundation/Foundation.h>
+
+#import "OHContactsDataProviderProtocol.h"
+#import "OHContactsPostProcessorProtocol.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Metrics of one data provider during a load
+ */
+@interface OHContactsDataProviderMetrics : NSObject
+
+- (instancetype)initWithDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider loadDuration:(NSTimeInterval)loadDuration transformDuration:(NSTimeInterval)transformDuration contactCount:(NSUInteger)contactCount NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, readonly) id<OHContactsDataProviderProtocol> dataProvider;
+
+/**
+ *  Time from the data source calling loadContacts on the data provider to the data provider finishing
+ */
+@property (nonatomic, readonly) NSTimeInterval loadDuration;
+
+/**
+ *  Part of loadDuration spent transforming records into contacts, 0 if the data provider does not report it
+ */
+@property (nonatomic, readonly) NSTimeInterval transformDuration;
+
+/**
+ *  Part of loadDuration not spent transforming records, which includes fetching them and waiting for authorization
+ */
+@property (nonatomic, readonly) NSTimeInterval fetchDuration;
+
+@property (nonatomic, readonly) NSUInteger contactCount;
+
+@end
+
+/**
+ *  Metrics of one post processor stage during a pipeline run
+ */
+@interface OHContactsPostProcessorMetrics : NSObject
+
+- (instancetype)initWithPostProcessor:(id<OHContactsPostProcessorProtocol>)postProcessor duration:(NSTimeInterval)duration inputCount:(NSUInteger)inputCount outputCount:(NSUInteger)outputCount reused:(BOOL)reused NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, readonly) id<OHContactsPostProcessorProtocol> postProcessor;
+
+/**
+ *  Wall time of processContacts:, 0 if the output of a previous run was reused
+ */
+@property (nonatomic, readonly) NSTimeInterval duration;
+
+@property (nonatomic, readonly) NSUInteger inputCount;
+
+@property (nonatomic, readonly) NSUInteger outputCount;
+
+/**
+ *  Whether the stage output was reused from a previous run instead of running the post processor
+ */
+@property (nonatomic, readonly, getter=isReused) BOOL reused;
+
+@end
+
+/**
+ *  Metrics of one pipeline run of the data source, from loadContacts (or reprocessContacts) to the ready signal
+ */
+@interface OHContactsDataSourceMetrics : NSObject
+
+- (instancetype)initWithDataProviderMetrics:(NSArray<OHContactsDataProviderMetrics *> *)dataProviderMetrics postProcessorMetrics:(NSArray<OHContactsPostProcessorMetrics *> *)postProcessorMetrics combineDuration:(NSTimeInterval)combineDuration readyDuration:(NSTimeInterval)readyDuration approximateAllocationCount:(NSInteger)approximateAllocationCount NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Metrics of each data provider, in data provider order (empty for reprocessContacts)
+ */
+@property (nonatomic, readonly) NSArray<OHContactsDataProviderMetrics *> *dataProviderMetrics;
+
+/**
+ *  Metrics of each post processor, in pipeline order
+ */
+@property (nonatomic, readonly) NSArray<OHContactsPostProcessorMetrics *> *postProcessorMetrics;
+
+/**
+ *  Time spent unioning or merging the contacts of the data providers
+ */
+@property (nonatomic, readonly) NSTimeInterval combineDuration;
+
+/**
+ *  Time from the start of the run to the ready signal
+ */
+@property (nonatomic, readonly) NSTimeInterval readyDuration;
+
+/**
+ *  Change in the number of heap blocks in use by the process during the run
+ *
+ *  @discussion This is a net, process-wide count: it includes allocations made by other threads and excludes objects freed before the end
+ *  of the run, so treat it as an order of magnitude.
+ */
+@property (nonatomic, readonly) NSInteger approximateAllocationCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
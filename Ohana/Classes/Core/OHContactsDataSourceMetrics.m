@@ -0,0 +1,79 @@
+//
+//  OHContactsDataSourceMetrics.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import "OHContactsDataSourceMetrics.h"
+
+@implementation OHContactsDataProviderMetrics
+
+- (instancetype)initWithDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider loadDuration:(NSTimeInterval)loadDuration transformDuration:(NSTimeInterval)transformDuration contactCount:(NSUInteger)contactCount
+{
+    if (self = [super init]) {
+        _dataProvider = dataProvider;
+        _loadDuration = loadDuration;
+        _transformDuration = transformDuration;
+        _contactCount = contactCount;
+    }
+    return self;
+}
+
+- (NSTimeInterval)fetchDuration
+{
+    return MAX(self.loadDuration - self.transformDuration, 0);
+}
+
+@end
+
+@implementation OHContactsPostProcessorMetrics
+
+- (instancetype)initWithPostProcessor:(id<OHContactsPostProcessorProtocol>)postProcessor duration:(NSTimeInterval)duration inputCount:(NSUInteger)inputCount outputCount:(NSUInteger)outputCount reused:(BOOL)reused
+{
+    if (self = [super init]) {
+        _postProcessor = postProcessor;
+        _duration = duration;
+        _inputCount = inputCount;
+        _outputCount = outputCount;
+        _reused = reused;
+    }
+    return self;
+}
+
+@end
+
+@implementation OHContactsDataSourceMetrics
+
+- (instancetype)initWithDataProviderMetrics:(NSArray<OHContactsDataProviderMetrics *> *)dataProviderMetrics postProcessorMetrics:(NSArray<OHContactsPostProcessorMetrics *> *)postProcessorMetrics combineDuration:(NSTimeInterval)combineDuration readyDuration:(NSTimeInterval)readyDuration approximateAllocationCount:(NSInteger)approximateAllocationCount
+{
+    if (self = [super init]) {
+        _dataProviderMetrics = [dataProviderMetrics copy];
+        _postProcessorMetrics = [postProcessorMetrics copy];
+        _combineDuration = combineDuration;
+        _readyDuration = readyDuration;
+        _approximateAllocationCount = approximateAllocationCount;
+    }
+    return self;
+}
+
+@end
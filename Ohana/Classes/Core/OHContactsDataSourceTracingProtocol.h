@@ -0,0 +1,63 @@
+//
+//  OHContactsDataSourceTracingProtocol.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <Foundation/Foundation.h>
+
+#import "OHContactsDataSourceMetrics.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class OHContactsDataSource;
+
+/**
+ *  Hooks called by the data source around each stage of its pipeline, for forwarding to a tracing or telemetry system
+ *
+ *  @discussion Stages are named "load" (loadContacts to the ready signal), "reprocess", "dataProvider.<class name>", "combine" and
+ *  "postProcessor.<class name>". Methods are called synchronously on the thread running the stage, so implementations should be cheap and
+ *  thread safe. Begin and end calls for the same stage may happen on different threads.
+ */
+@protocol OHContactsDataSourceTracingProtocol <NSObject>
+
+@optional
+
+/**
+ *  Called when a stage begins
+ */
+- (void)contactsDataSource:(OHContactsDataSource *)dataSource didBeginStage:(NSString *)stage;
+
+/**
+ *  Called when a stage ends
+ */
+- (void)contactsDataSource:(OHContactsDataSource *)dataSource didEndStage:(NSString *)stage duration:(NSTimeInterval)duration;
+
+/**
+ *  Called with the metrics of each pipeline run, right after onContactsDataSourceMetricsSignal fires
+ */
+- (void)contactsDataSource:(OHContactsDataSource *)dataSource didCollectMetrics:(OHContactsDataSourceMetrics *)metrics;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,152 @@
+//
+//  OHContactsIndexVector.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "OHContact.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@protocol OHContactsPostProcessorProtocol;
+
+/**
+ *  Block deciding whether a contact is kept by indexVectorPassingTest:
+ */
+typedef BOOL (^OHContactsIndexVectorTestBlock)(OHContact *contact);
+
+/**
+ *  Ordered view onto an immutable array of base contacts, stored as a vector of 32 bit positions into that array
+ *
+ *  @discussion Post processors conforming to OHContactsIndexVectorPostProcessorProtocol narrow or reorder the vector instead of building a
+ *  new hashed ordered set, so a pipeline of such stages shares a single base array and only materializes the contacts of the last stage.
+ *  Positions are unique, as vectors are only ever derived by filtering or permuting their parent.
+ */
+@interface OHContactsIndexVector : NSObject
+
+/**
+ *  Creates a vector covering every contact of the ordered set, in order
+ *
+ *  @discussion The ordered set is copied, so later mutations of a mutable ordered set do not affect the vector.
+ */
+- (instancetype)initWithContacts:(NSOrderedSet<OHContact *> *)contacts;
+
+/**
+ *  Creates a vector from positions into baseContacts
+ *
+ *  @param baseContacts Contacts the positions refer to, which must not contain duplicates
+ *  @param positions    Buffer of uint32_t positions into baseContacts, which must not contain duplicates
+ */
+- (instancetype)initWithBaseContacts:(NSArray<OHContact *> *)baseContacts positions:(NSData *)positions NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Contacts the positions refer to, shared by every vector derived from this one
+ */
+@property (nonatomic, readonly) NSArray<OHContact *> *baseContacts;
+
+@property (nonatomic, readonly) NSUInteger count;
+
+/**
+ *  The count positions of the vector, valid for the lifetime of the vector
+ */
+@property (nonatomic, readonly) const uint32_t *positions NS_RETURNS_INNER_POINTER;
+
+- (OHContact *)contactAtIndex:(NSUInteger)index;
+
+/**
+ *  Returns a vector with the contacts passing the test, in the same order and over the same base contacts
+ */
+- (OHContactsIndexVector *)indexVectorPassingTest:(OHContactsIndexVectorTestBlock)testBlock;
+
+/**
+ *  Returns a vector over the same base contacts with the given positions, for stages that reorder or select contacts themselves
+ *
+ *  @param positions Buffer of uint32_t positions into baseContacts, which must not contain duplicates
+ */
+- (OHContactsIndexVector *)indexVectorWithPositions:(NSData *)positions;
+
+- (OHContactsIndexVector *)reversedIndexVector;
+
+/**
+ *  Returns a vector with the positions of the given contacts that are in this vector, in the order of contacts
+ */
+- (OHContactsIndexVector *)indexVectorOfContacts:(NSOrderedSet<OHContact *> *)contacts;
+
+/**
+ *  Runs a post processor on the vector, passing it the materialized contacts if it does not conform to
+ *  OHContactsIndexVectorPostProcessorProtocol
+ *
+ *  @discussion A nil result is an empty vector. If the post processor returns contacts that are not in this vector, such as copies or
+ *  projections, the result is a vector over a new base holding the returned contacts, which the set algebra methods cannot combine with
+ *  vectors over this vector's base.
+ */
+- (OHContactsIndexVector *)indexVectorProcessedByPostProcessor:(id<OHContactsPostProcessorProtocol>)postProcessor;
+
+/**
+ *  Runs each post processor on the vector as described in indexVectorProcessedByPostProcessor:, and returns the results in the same order
+ *
+ *  @discussion When concurrently is YES the post processors run at the same time on a global concurrent queue, so they must not share
+ *  mutable state. This method returns once all of them have finished.
+ */
+- (NSArray<OHContactsIndexVector *> *)indexVectorsProcessedByPostProcessors:(NSArray<id<OHContactsPostProcessorProtocol>> *)postProcessors concurrently:(BOOL)concurrently;
+
+#pragma mark - Set Algebra
+
+/**
+ *  The following methods take vectors over the same base contacts and evaluate membership with a bitset over the base positions, so each
+ *  runs in time linear in the lengths of the vectors.
+ */
+
+/**
+ *  Whether each of indexVectors has the same base contacts as this vector, and so can be combined with it
+ */
+- (BOOL)sharesBaseContactsWithIndexVectors:(NSArray<OHContactsIndexVector *> *)indexVectors;
+
+/**
+ *  Returns the positions of this vector that are also in indexVector, in the order of this vector
+ */
+- (OHContactsIndexVector *)indexVectorIntersectingIndexVector:(OHContactsIndexVector *)indexVector;
+
+/**
+ *  Returns the positions of this vector followed by the positions of each of indexVectors that were not already added, in order
+ */
+- (OHContactsIndexVector *)indexVectorUnioningIndexVectors:(NSArray<OHContactsIndexVector *> *)indexVectors;
+
+/**
+ *  Returns the positions of this vector that are not in indexVector followed by the positions of indexVector that are not in this vector
+ */
+- (OHContactsIndexVector *)indexVectorSymmetricDifferenceWithIndexVector:(OHContactsIndexVector *)indexVector;
+
+/**
+ *  Materializes the contacts of the vector
+ *
+ *  @discussion A vector created with initWithContacts: and never narrowed returns its copy of the ordered set it was created with.
+ */
+- (NSOrderedSet<OHContact *> *)contacts;
+
+@end
+
+NS_ASSUME_NONNULL_END
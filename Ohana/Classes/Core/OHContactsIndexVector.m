@@ -0,0 +1,311 @@
+//
+//  OHContactsIndexVector.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHContactsIndexVector.h"
+
+#import "OHContactsIndexVectorPostProcessorProtocol.h"
+
+/**
+ *  Allocates a zeroed bitset with one bit per base position, to be released with free()
+ */
+static uint64_t *OHContactsIndexVectorCreateBitset(NSUInteger baseCount)
+{
+    return calloc(MAX((baseCount + 63) / 64, 1), sizeof(uint64_t));
+}
+
+static inline BOOL OHContactsIndexVectorBitsetContains(const uint64_t *bitset, uint32_t position)
+{
+    return (bitset[position >> 6] >> (position & 63)) & 1;
+}
+
+static inline void OHContactsIndexVectorBitsetAdd(uint64_t *bitset, uint32_t position)
+{
+    bitset[position >> 6] |= (uint64_t)1 << (position & 63);
+}
+
+@interface OHContactsIndexVector ()
+
+@property (nonatomic, readwrite) NSArray<OHContact *> *baseContacts;
+@property (nonatomic) NSData *positionsData;
+
+/**
+ *  The ordered set the vector was created from, kept while the vector still covers all of it in order
+ */
+@property (nonatomic, nullable) NSOrderedSet<OHContact *> *sourceContacts;
+
+@end
+
+@implementation OHContactsIndexVector
+
+- (instancetype)initWithContacts:(NSOrderedSet<OHContact *> *)contacts
+{
+    NSParameterAssert(contacts.count <= UINT32_MAX);
+    NSUInteger count = contacts.count;
+    NSMutableData *positions = [[NSMutableData alloc] initWithLength:count * sizeof(uint32_t)];
+    uint32_t *bytes = positions.mutableBytes;
+    for (NSUInteger i = 0; i < count; i++) {
+        bytes[i] = (uint32_t)i;
+    }
+    // The array of a mutable ordered set follows its mutations, which would leave the positions stale
+    NSOrderedSet<OHContact *> *sourceContacts = [contacts copy];
+    if (self = [self initWithBaseContacts:sourceContacts.array positions:positions]) {
+        _sourceContacts = sourceContacts;
+    }
+    return self;
+}
+
+- (instancetype)initWithBaseContacts:(NSArray<OHContact *> *)baseContacts positions:(NSData *)positions
+{
+    NSParameterAssert(positions.length % sizeof(uint32_t) == 0);
+    if (self = [super init]) {
+        _baseContacts = baseContacts;
+        _positionsData = [positions copy];
+    }
+    return self;
+}
+
+- (NSUInteger)count
+{
+    return self.positionsData.length / sizeof(uint32_t);
+}
+
+- (const uint32_t *)positions
+{
+    return self.positionsData.bytes;
+}
+
+- (OHContact *)contactAtIndex:(NSUInteger)index
+{
+    NSParameterAssert(index < self.count);
+    return [self.baseContacts objectAtIndex:self.positions[index]];
+}
+
+- (OHContactsIndexVector *)indexVectorPassingTest:(OHContactsIndexVectorTestBlock)testBlock
+{
+    NSArray<OHContact *> *baseContacts = self.baseContacts;
+    return [self _indexVectorPassingPositionTest:^BOOL(uint32_t position) {
+        return testBlock([baseContacts objectAtIndex:position]);
+    }];
+}
+
+- (OHContactsIndexVector *)indexVectorWithPositions:(NSData *)positions
+{
+    return [[OHContactsIndexVector alloc] initWithBaseContacts:self.baseContacts positions:positions];
+}
+
+- (OHContactsIndexVector *)reversedIndexVector
+{
+    NSUInteger count = self.count;
+    const uint32_t *positions = self.positions;
+    NSMutableData *reversedPositions = [[NSMutableData alloc] initWithLength:count * sizeof(uint32_t)];
+    uint32_t *reversedBytes = reversedPositions.mutableBytes;
+    for (NSUInteger i = 0; i < count; i++) {
+        reversedBytes[i] = positions[count - 1 - i];
+    }
+    return [self indexVectorWithPositions:reversedPositions];
+}
+
+- (OHContactsIndexVector *)indexVectorOfContacts:(NSOrderedSet<OHContact *> *)contacts
+{
+    NSUInteger count = self.count;
+    const uint32_t *positions = self.positions;
+    NSMapTable<OHContact *, NSNumber *> *positionsByContact = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory valueOptions:NSPointerFunctionsStrongMemory capacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [positionsByContact setObject:@(positions[i]) forKey:[self.baseContacts objectAtIndex:positions[i]]];
+    }
+
+    NSMutableData *contactPositions = [[NSMutableData alloc] initWithLength:MIN(contacts.count, count) * sizeof(uint32_t)];
+    uint32_t *contactBytes = contactPositions.mutableBytes;
+    NSUInteger contactCount = 0;
+    for (OHContact *contact in contacts) {
+        NSNumber *position = [positionsByContact objectForKey:contact];
+        if (position && contactCount < count) {
+            contactBytes[contactCount++] = position.unsignedIntValue;
+        }
+    }
+    contactPositions.length = contactCount * sizeof(uint32_t);
+    return [self indexVectorWithPositions:contactPositions];
+}
+
+- (OHContactsIndexVector *)indexVectorProcessedByPostProcessor:(id<OHContactsPostProcessorProtocol>)postProcessor
+{
+    if ([postProcessor conformsToProtocol:@protocol(OHContactsIndexVectorPostProcessorProtocol)]) {
+        return [(id<OHContactsIndexVectorPostProcessorProtocol>)postProcessor processIndexVector:self];
+    }
+    NSOrderedSet<OHContact *> *processedContacts = [postProcessor processContacts:[self contacts]] ?: [NSOrderedSet<OHContact *> orderedSet];
+    OHContactsIndexVector *processedIndexVector = [self indexVectorOfContacts:processedContacts];
+    if (processedIndexVector.count < processedContacts.count) {
+        // Some contacts are not in this vector, such as copies or projections, so only a vector over a new base can hold them
+        return [[OHContactsIndexVector alloc] initWithContacts:processedContacts];
+    }
+    return processedIndexVector;
+}
+
+- (NSArray<OHContactsIndexVector *> *)indexVectorsProcessedByPostProcessors:(NSArray<id<OHContactsPostProcessorProtocol>> *)postProcessors concurrently:(BOOL)concurrently
+{
+    NSMutableArray<OHContactsIndexVector *> *indexVectors = [[NSMutableArray<OHContactsIndexVector *> alloc] initWithCapacity:postProcessors.count];
+    if (!concurrently || postProcessors.count < 2) {
+        for (id<OHContactsPostProcessorProtocol> postProcessor in postProcessors) {
+            [indexVectors addObject:[self indexVectorProcessedByPostProcessor:postProcessor]];
+        }
+        return indexVectors;
+    }
+
+    for (NSUInteger i = 0; i < postProcessors.count; i++) {
+        [indexVectors addObject:self];
+    }
+    dispatch_apply(postProcessors.count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
+        OHContactsIndexVector *indexVector = [self indexVectorProcessedByPostProcessor:[postProcessors objectAtIndex:i]];
+        @synchronized (indexVectors) {
+            [indexVectors replaceObjectAtIndex:i withObject:indexVector];
+        }
+    });
+    return indexVectors;
+}
+
+#pragma mark - Set Algebra
+
+- (BOOL)sharesBaseContactsWithIndexVectors:(NSArray<OHContactsIndexVector *> *)indexVectors
+{
+    for (OHContactsIndexVector *indexVector in indexVectors) {
+        if (indexVector.baseContacts != self.baseContacts) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+- (OHContactsIndexVector *)indexVectorIntersectingIndexVector:(OHContactsIndexVector *)indexVector
+{
+    NSParameterAssert(indexVector.baseContacts == self.baseContacts);
+    uint64_t *bitset = OHContactsIndexVectorCreateBitset(self.baseContacts.count);
+    for (NSUInteger i = 0; i < indexVector.count; i++) {
+        OHContactsIndexVectorBitsetAdd(bitset, indexVector.positions[i]);
+    }
+    OHContactsIndexVector *intersection = [self _indexVectorPassingPositionTest:^BOOL(uint32_t position) {
+        return OHContactsIndexVectorBitsetContains(bitset, position);
+    }];
+    free(bitset);
+    return intersection;
+}
+
+- (OHContactsIndexVector *)indexVectorUnioningIndexVectors:(NSArray<OHContactsIndexVector *> *)indexVectors
+{
+    NSUInteger maximumCount = self.count;
+    for (OHContactsIndexVector *indexVector in indexVectors) {
+        NSParameterAssert(indexVector.baseContacts == self.baseContacts);
+        maximumCount += indexVector.count;
+    }
+
+    uint64_t *bitset = OHContactsIndexVectorCreateBitset(self.baseContacts.count);
+    NSMutableData *unionPositions = [[NSMutableData alloc] initWithLength:MIN(maximumCount, self.baseContacts.count) * sizeof(uint32_t)];
+    uint32_t *unionBytes = unionPositions.mutableBytes;
+    NSUInteger unionCount = 0;
+    for (OHContactsIndexVector *indexVector in [@[self] arrayByAddingObjectsFromArray:indexVectors]) {
+        const uint32_t *positions = indexVector.positions;
+        for (NSUInteger i = 0; i < indexVector.count; i++) {
+            if (!OHContactsIndexVectorBitsetContains(bitset, positions[i])) {
+                OHContactsIndexVectorBitsetAdd(bitset, positions[i]);
+                unionBytes[unionCount++] = positions[i];
+            }
+        }
+    }
+    free(bitset);
+    unionPositions.length = unionCount * sizeof(uint32_t);
+    return [self indexVectorWithPositions:unionPositions];
+}
+
+- (OHContactsIndexVector *)indexVectorSymmetricDifferenceWithIndexVector:(OHContactsIndexVector *)indexVector
+{
+    NSParameterAssert(indexVector.baseContacts == self.baseContacts);
+    uint64_t *bitset = OHContactsIndexVectorCreateBitset(self.baseContacts.count);
+    uint64_t *otherBitset = OHContactsIndexVectorCreateBitset(self.baseContacts.count);
+    for (NSUInteger i = 0; i < self.count; i++) {
+        OHContactsIndexVectorBitsetAdd(bitset, self.positions[i]);
+    }
+    for (NSUInteger i = 0; i < indexVector.count; i++) {
+        OHContactsIndexVectorBitsetAdd(otherBitset, indexVector.positions[i]);
+    }
+
+    NSMutableData *differencePositions = [[NSMutableData alloc] initWithLength:(self.count + indexVector.count) * sizeof(uint32_t)];
+    uint32_t *differenceBytes = differencePositions.mutableBytes;
+    NSUInteger differenceCount = 0;
+    for (NSUInteger i = 0; i < self.count; i++) {
+        if (!OHContactsIndexVectorBitsetContains(otherBitset, self.positions[i])) {
+            differenceBytes[differenceCount++] = self.positions[i];
+        }
+    }
+    for (NSUInteger i = 0; i < indexVector.count; i++) {
+        if (!OHContactsIndexVectorBitsetContains(bitset, indexVector.positions[i])) {
+            differenceBytes[differenceCount++] = indexVector.positions[i];
+        }
+    }
+    free(bitset);
+    free(otherBitset);
+    differencePositions.length = differenceCount * sizeof(uint32_t);
+    return [self indexVectorWithPositions:differencePositions];
+}
+
+#pragma mark - Private
+
+- (OHContactsIndexVector *)_indexVectorPassingPositionTest:(BOOL (^)(uint32_t position))testBlock
+{
+    NSUInteger count = self.count;
+    const uint32_t *positions = self.positions;
+    NSMutableData *passingPositions = [[NSMutableData alloc] initWithLength:count * sizeof(uint32_t)];
+    uint32_t *passingBytes = passingPositions.mutableBytes;
+    NSUInteger passingCount = 0;
+    for (NSUInteger i = 0; i < count; i++) {
+        if (testBlock(positions[i])) {
+            passingBytes[passingCount++] = positions[i];
+        }
+    }
+    if (passingCount == count) {
+        return self;
+    }
+    passingPositions.length = passingCount * sizeof(uint32_t);
+    return [self indexVectorWithPositions:passingPositions];
+}
+
+#pragma mark - Materializing
+
+- (NSOrderedSet<OHContact *> *)contacts
+{
+    if (self.sourceContacts) {
+        return self.sourceContacts;
+    }
+
+    NSUInteger count = self.count;
+    const uint32_t *positions = self.positions;
+    __unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(MAX(count, 1) * sizeof(id));
+    for (NSUInteger i = 0; i < count; i++) {
+        objects[i] = [self.baseContacts objectAtIndex:positions[i]];
+    }
+    NSOrderedSet<OHContact *> *contacts = [[NSOrderedSet<OHContact *> alloc] initWithObjects:objects count:count];
+    free(objects);
+    return contacts;
+}
+
+@end
@@ -0,0 +1,55 @@
+//
+//  OHContactsIndexVectorPostProcessorProtocol.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "OHContactsIndexVector.h"
+#import "OHContactsPostProcessorProtocol.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Post processors that only remove or reorder contacts can adopt this protocol to work on an index vector instead of an ordered set
+ *
+ *  @discussion The data source runs consecutive post processors that conform to this protocol on a shared index vector, and only
+ *  materializes an ordered set for post processors that do not conform to it and for the final result.
+ */
+@protocol OHContactsIndexVectorPostProcessorProtocol <OHContactsPostProcessorProtocol>
+
+/**
+ *  Index vector form of processContacts:
+ *
+ *  @discussion The returned vector must be derived from indexVector (or be indexVector itself), and hold the same contacts in the same
+ *  order as processContacts: would return for the contacts of indexVector.
+ *
+ *  @param indexVector The contacts to be run through the post processor
+ *
+ *  @return The contacts processed by the post processor
+ */
+- (OHContactsIndexVector *)processIndexVector:(OHContactsIndexVector *)indexVector;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,85 @@
+//
+//  OHContactsMerger.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <Foundation/Foundation.h>
+
+#import "OHContact.h"
+#import "OHContactsDataProviderProtocol.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+extern NSString *_Nonnull kOHContactsMergerSourceContactsKey; // Contacts a merged contact was created from, in precedence order (NSArray<OHContact *> *)
+
+/**
+ *  Merges the contacts of several data providers that represent the same person
+ *
+ *  @discussion Contacts are matched through a hash index over their identity keys: the identifiers reported by the data providers'
+ *  contactIdentifierForContact: method, phone numbers reduced to their last ten digits, and lowercased email addresses. Contacts of different
+ *  data providers sharing any key, directly or through other contacts, are merged into a single new contact, which holds at most one contact
+ *  of each data provider. Contacts of the same data provider, such as family members sharing a landline, are never merged. Contacts that
+ *  match nothing are returned unchanged.
+ */
+@interface OHContactsMerger : NSObject
+
+/**
+ *  Creates the merger
+ *
+ *  @param dataProviderPrecedence Data providers in decreasing order of precedence (optional). Data providers that are not listed rank after the
+ *  listed ones, in the order they are passed to mergeContactsByDataProvider:dataProviders:.
+ */
+- (instancetype)initWithDataProviderPrecedence:(NSOrderedSet<id<OHContactsDataProviderProtocol>> *_Nullable)dataProviderPrecedence NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Data providers in decreasing order of precedence
+ */
+@property (nonatomic, readonly, nullable) NSOrderedSet<id<OHContactsDataProviderProtocol>> *dataProviderPrecedence;
+
+/**
+ *  Phone numbers with fewer digits are not used to match contacts, so that short codes do not merge unrelated contacts
+ *
+ *  @discussion Defaults to 7
+ */
+@property (nonatomic) NSUInteger minimumPhoneNumberLength;
+
+/**
+ *  Merges the contacts loaded by the data providers
+ *
+ *  @discussion The names, organization and thumbnail photo of a merged contact come from the first contact with a value, in precedence
+ *  order. Contact fields and postal addresses are combined, dropping duplicates of values already contributed by a contact with higher
+ *  precedence. Tags are combined, and custom properties of contacts with higher precedence win.
+ *
+ *  @param contactsByDataProvider The contacts loaded by each data provider
+ *  @param dataProviders          The data providers in the order their contacts should appear
+ *
+ *  @return One contact per person, ordered by the first appearance of any of its source contacts
+ */
+- (NSOrderedSet<OHContact *> *)mergeContactsByDataProvider:(NSMapTable<id<OHContactsDataProviderProtocol>, NSOrderedSet<OHContact *> *> *)contactsByDataProvider dataProviders:(NSOrderedSet<id<OHContactsDataProviderProtocol>> *)dataProviders;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,293 @@
+//
+//  OHContactsMerger.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import "OHContactsMerger.h"
+
+const NSString *kOHContactsMergerSourceContactsKey = @"kOHContactsMergerSourceContactsKey";
+
+static const NSUInteger kOHContactsMergerPhoneNumberSuffixLength = 10;
+
+static NSUInteger OHContactsMergerFindRoot(NSUInteger *parents, NSUInteger index)
+{
+    while (parents[index] != index) {
+        parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+    return index;
+}
+
+static BOOL OHContactsMergerIndexSetsIntersect(NSIndexSet *indexSet, NSIndexSet *otherIndexSet)
+{
+    __block BOOL intersects = NO;
+    [indexSet enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+        intersects = [otherIndexSet containsIndex:index];
+        *stop = intersects;
+    }];
+    return intersects;
+}
+
+@implementation OHContactsMerger
+
+- (instancetype)initWithDataProviderPrecedence:(NSOrderedSet<id<OHContactsDataProviderProtocol>> *)dataProviderPrecedence
+{
+    if (self = [super init]) {
+        _dataProviderPrecedence = dataProviderPrecedence;
+        _minimumPhoneNumberLength = 7;
+    }
+    return self;
+}
+
+- (NSOrderedSet<OHContact *> *)mergeContactsByDataProvider:(NSMapTable<id<OHContactsDataProviderProtocol>, NSOrderedSet<OHContact *> *> *)contactsByDataProvider dataProviders:(NSOrderedSet<id<OHContactsDataProviderProtocol>> *)dataProviders
+{
+    NSMutableArray<OHContact *> *contacts = [[NSMutableArray<OHContact *> alloc] init];
+    NSMutableArray<NSNumber *> *ranks = [[NSMutableArray<NSNumber *> alloc] init];
+    NSMutableArray<NSNumber *> *dataProviderIndexes = [[NSMutableArray<NSNumber *> alloc] init];
+    NSMutableDictionary<NSString *, NSMutableArray<NSNumber *> *> *contactIndexesForKey = [[NSMutableDictionary alloc] init];
+    NSMutableArray<NSArray<NSString *> *> *keysOfContacts = [[NSMutableArray alloc] init];
+    NSMutableSet<OHContact *> *seenContacts = [[NSMutableSet<OHContact *> alloc] init];
+
+    for (NSUInteger dataProviderIndex = 0; dataProviderIndex < dataProviders.count; dataProviderIndex++) {
+        id<OHContactsDataProviderProtocol> dataProvider = [dataProviders objectAtIndex:dataProviderIndex];
+        NSUInteger rank = [self _rankOfDataProvider:dataProvider atIndex:dataProviderIndex];
+        for (OHContact *contact in [contactsByDataProvider objectForKey:dataProvider]) {
+            // The same contact object may be returned by several data providers, keep the first one like a plain union would
+            if ([seenContacts containsObject:contact]) {
+                continue;
+            }
+            [seenContacts addObject:contact];
+            [contacts addObject:contact];
+            [ranks addObject:@(rank)];
+            [dataProviderIndexes addObject:@(dataProviderIndex)];
+            [keysOfContacts addObject:[self _identityKeysForContact:contact dataProviders:dataProviders]];
+        }
+    }
+
+    // Each group holds at most one contact per data provider, so contacts of the same data provider, such as family members sharing a landline
+    // or an email address, are never merged, neither directly nor through a contact of another data provider
+    NSUInteger *parents = malloc(MAX(contacts.count, 1) * sizeof(NSUInteger));
+    NSMutableArray<NSMutableIndexSet *> *dataProvidersOfGroups = [[NSMutableArray<NSMutableIndexSet *> alloc] initWithCapacity:contacts.count];
+    for (NSUInteger i = 0; i < contacts.count; i++) {
+        parents[i] = i;
+        [dataProvidersOfGroups addObject:[[NSMutableIndexSet alloc] initWithIndex:[dataProviderIndexes objectAtIndex:i].unsignedIntegerValue]];
+        for (NSString *key in [keysOfContacts objectAtIndex:i]) {
+            NSMutableArray<NSNumber *> *matchedIndexes = [contactIndexesForKey objectForKey:key];
+            if (!matchedIndexes) {
+                [contactIndexesForKey setObject:[[NSMutableArray<NSNumber *> alloc] initWithObjects:@(i), nil] forKey:key];
+                continue;
+            }
+            for (NSNumber *matchedIndex in matchedIndexes) {
+                NSUInteger root = OHContactsMergerFindRoot(parents, i);
+                NSUInteger matchedRoot = OHContactsMergerFindRoot(parents, matchedIndex.unsignedIntegerValue);
+                NSMutableIndexSet *groupDataProviders = [dataProvidersOfGroups objectAtIndex:root];
+                NSMutableIndexSet *matchedGroupDataProviders = [dataProvidersOfGroups objectAtIndex:matchedRoot];
+                if (root == matchedRoot || OHContactsMergerIndexSetsIntersect(groupDataProviders, matchedGroupDataProviders)) {
+                    continue;
+                }
+                // The earliest contact stays the root so merged contacts keep the position of their first source contact
+                if (root < matchedRoot) {
+                    parents[matchedRoot] = root;
+                    [groupDataProviders addIndexes:matchedGroupDataProviders];
+                } else {
+                    parents[root] = matchedRoot;
+                    [matchedGroupDataProviders addIndexes:groupDataProviders];
+                }
+            }
+            if (![matchedIndexes.lastObject isEqualToNumber:@(i)]) {
+                [matchedIndexes addObject:@(i)];
+            }
+        }
+    }
+
+    NSMutableArray<NSNumber *> *roots = [[NSMutableArray<NSNumber *> alloc] init];
+    NSMutableDictionary<NSNumber *, NSMutableArray<NSNumber *> *> *groups = [[NSMutableDictionary alloc] init];
+    for (NSUInteger i = 0; i < contacts.count; i++) {
+        NSNumber *root = @(OHContactsMergerFindRoot(parents, i));
+        NSMutableArray<NSNumber *> *group = [groups objectForKey:root];
+        if (!group) {
+            group = [[NSMutableArray<NSNumber *> alloc] init];
+            [groups setObject:group forKey:root];
+            [roots addObject:root];
+        }
+        [group addObject:@(i)];
+    }
+    free(parents);
+
+    NSMutableOrderedSet<OHContact *> *mergedContacts = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:roots.count];
+    for (NSNumber *root in roots) {
+        NSArray<NSNumber *> *group = [groups objectForKey:root];
+        if (group.count == 1) {
+            [mergedContacts addObject:[contacts objectAtIndex:root.unsignedIntegerValue]];
+            continue;
+        }
+        // Stable sort, so contacts from the same data provider keep their order
+        NSArray<NSNumber *> *sortedGroup = [group sortedArrayWithOptions:NSSortStable usingComparator:^NSComparisonResult(NSNumber *index1, NSNumber *index2) {
+            return [[ranks objectAtIndex:index1.unsignedIntegerValue] compare:[ranks objectAtIndex:index2.unsignedIntegerValue]];
+        }];
+        NSMutableArray<OHContact *> *sourceContacts = [[NSMutableArray<OHContact *> alloc] initWithCapacity:sortedGroup.count];
+        for (NSNumber *index in sortedGroup) {
+            [sourceContacts addObject:[contacts objectAtIndex:index.unsignedIntegerValue]];
+        }
+        [mergedContacts addObject:[self _mergedContactWithSourceContacts:sourceContacts]];
+    }
+    return mergedContacts;
+}
+
+#pragma mark - Private
+
+- (NSUInteger)_rankOfDataProvider:(id<OHContactsDataProviderProtocol>)dataProvider atIndex:(NSUInteger)index
+{
+    NSUInteger precedence = [self.dataProviderPrecedence indexOfObject:dataProvider];
+    return precedence != NSNotFound ? precedence : self.dataProviderPrecedence.count + index;
+}
+
+- (NSArray<NSString *> *)_identityKeysForContact:(OHContact *)contact dataProviders:(NSOrderedSet<id<OHContactsDataProviderProtocol>> *)dataProviders
+{
+    NSMutableArray<NSString *> *keys = [[NSMutableArray<NSString *> alloc] init];
+    // Every data provider is asked, so a contact that carries another data provider's identifier (for example a server record linked to a
+    // device contact) matches that data provider's contact. Identifiers are namespaced since data providers do not share an identifier space.
+    for (id<OHContactsDataProviderProtocol> dataProvider in dataProviders) {
+        if ([dataProvider respondsToSelector:@selector(contactIdentifierForContact:)]) {
+            NSString *contactIdentifier = [dataProvider contactIdentifierForContact:contact];
+            if (contactIdentifier.length) {
+                [keys addObject:[NSString stringWithFormat:@"id:%@:%@", NSStringFromClass([dataProvider class]), contactIdentifier]];
+            }
+        }
+    }
+    for (OHContactField *contactField in contact.contactFields) {
+        NSString *key = [self _identityKeyForContactField:contactField];
+        if (key) {
+            [keys addObject:key];
+        }
+    }
+    return keys;
+}
+
+- (NSString *_Nullable)_identityKeyForContactField:(OHContactField *)contactField
+{
+    switch (contactField.type) {
+        case OHContactFieldTypePhoneNumber: {
+            NSString *digits = [self _normalizedPhoneNumber:contactField.value];
+            return digits ? [@"tel:" stringByAppendingString:digits] : nil;
+        }
+        case OHContactFieldTypeEmailAddress: {
+            NSString *emailAddress = [self _normalizedEmailAddress:contactField.value];
+            return emailAddress.length ? [@"email:" stringByAppendingString:emailAddress] : nil;
+        }
+        default:
+            return nil;
+    }
+}
+
+/**
+ *  Keeps the last ten digits, so that the same number written with and without its country or trunk prefix produces the same key
+ */
+- (NSString *_Nullable)_normalizedPhoneNumber:(NSString *)phoneNumber
+{
+    NSUInteger length = phoneNumber.length;
+    unichar *digits = malloc(MAX(length, 1) * sizeof(unichar));
+    NSUInteger digitCount = 0;
+    for (NSUInteger i = 0; i < length; i++) {
+        unichar character = [phoneNumber characterAtIndex:i];
+        if (character >= '0' && character <= '9') {
+            digits[digitCount++] = character;
+        }
+    }
+
+    NSString *normalizedPhoneNumber = nil;
+    if (digitCount && digitCount >= self.minimumPhoneNumberLength) {
+        NSUInteger suffixLength = MIN(digitCount, kOHContactsMergerPhoneNumberSuffixLength);
+        normalizedPhoneNumber = [NSString stringWithCharacters:digits + digitCount - suffixLength length:suffixLength];
+    }
+    free(digits);
+    return normalizedPhoneNumber;
+}
+
+- (NSString *)_normalizedEmailAddress:(NSString *)emailAddress
+{
+    return [[emailAddress stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]] lowercaseString];
+}
+
+- (OHContact *)_mergedContactWithSourceContacts:(NSArray<OHContact *> *)sourceContacts
+{
+    OHContact *mergedContact = [[OHContact alloc] init];
+    NSMutableOrderedSet<OHContactField *> *contactFields = [[NSMutableOrderedSet<OHContactField *> alloc] init];
+    NSMutableSet<NSString *> *contactFieldKeys = [[NSMutableSet<NSString *> alloc] init];
+    NSMutableOrderedSet<OHContactAddress *> *postalAddresses = [[NSMutableOrderedSet<OHContactAddress *> alloc] init];
+    NSMutableSet<NSString *> *postalAddressKeys = [[NSMutableSet<NSString *> alloc] init];
+
+    for (OHContact *contact in sourceContacts) {
+        if (!mergedContact.fullName.length) {
+            mergedContact.fullName = contact.fullName;
+        }
+        if (!mergedContact.firstName.length) {
+            mergedContact.firstName = contact.firstName;
+        }
+        if (!mergedContact.lastName.length) {
+            mergedContact.lastName = contact.lastName;
+        }
+        if (!mergedContact.organizationName.length) {
+            mergedContact.organizationName = contact.organizationName;
+        }
+        if (!mergedContact.jobTitle.length) {
+            mergedContact.jobTitle = contact.jobTitle;
+        }
+        if (!mergedContact.departmentName.length) {
+            mergedContact.departmentName = contact.departmentName;
+        }
+#if TARGET_OS_IPHONE
+        if (!mergedContact.thumbnailPhoto) {
+            mergedContact.thumbnailPhoto = contact.thumbnailPhoto;
+        }
+#endif
+
+        for (OHContactField *contactField in contact.contactFields) {
+            NSString *key = [self _identityKeyForContactField:contactField] ?: [NSString stringWithFormat:@"%ld:%@", (long)contactField.type, contactField.value];
+            if (![contactFieldKeys containsObject:key]) {
+                [contactFieldKeys addObject:key];
+                [contactFields addObject:contactField];
+            }
+        }
+        for (OHContactAddress *postalAddress in contact.postalAddresses) {
+            NSString *key = [[NSString stringWithFormat:@"%@|%@|%@|%@|%@", postalAddress.street, postalAddress.city, postalAddress.state, postalAddress.postalCode, postalAddress.country] lowercaseString];
+            if (![postalAddressKeys containsObject:key]) {
+                [postalAddressKeys addObject:key];
+                [postalAddresses addObject:postalAddress];
+            }
+        }
+
+        [mergedContact.tags unionSet:contact.tags];
+    }
+
+    mergedContact.contactFields = contactFields;
+    mergedContact.postalAddresses = postalAddresses;
+    for (OHContact *contact in [sourceContacts reverseObjectEnumerator]) {
+        [mergedContact.customProperties addEntriesFromDictionary:contact.customProperties];
+    }
+    [mergedContact.customProperties setObject:sourceContacts forKey:kOHContactsMergerSourceContactsKey];
+    return mergedContact;
+}
+
+@end
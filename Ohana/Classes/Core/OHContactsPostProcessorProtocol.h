@@ -52,6 +52,20 @@ CreateSignalInterface(OHContactsPostProcessorFinishedSignal, NSOrderedSet<OHCont
  */
 - (NSOrderedSet<OHContact *> *_Nullable)processContacts:(NSOrderedSet<OHContact *> *)preProcessedContacts;
 
+@optional
+
+/**
+ *  Fingerprint of the post processor's configuration
+ *
+ *  @discussion Two post processors with equal fingerprints must return the same contacts for the same input. The data source uses the
+ *  fingerprint to reuse the output of a pipeline stage when neither its input nor its configuration changed. Post processors that do not
+ *  implement this method, or return nil from it, are always re-run, along with every stage after them.
+ *
+ *  @return A string that changes whenever the output of processContacts: for a given input would change, or nil if the configuration
+ *  cannot be fingerprinted
+ */
+- (nullable NSString *)configurationFingerprint;
+
 @end
 
 NS_ASSUME_NONNULL_END
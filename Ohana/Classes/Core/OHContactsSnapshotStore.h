@@ -0,0 +1,99 @@
+//
+//  OHContactsSnapshotStore.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <Foundation/Foundation.h>
+
+#import "OHContact.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, OHContactsSnapshotStoreErrorCode) {
+    OHContactsSnapshotStoreErrorCodeUnknown,            // Default
+    OHContactsSnapshotStoreErrorCodeVersionMismatch,    // The snapshot was written by a different format or content version and was ignored
+    OHContactsSnapshotStoreErrorCodeCorrupted           // The snapshot is truncated or malformed
+};
+
+extern NSString *const OHContactsSnapshotStoreErrorDomain;
+
+/**
+ *  Stores processed contacts in a compact, versioned binary file that can be read back without running the data providers or post processors
+ *
+ *  @discussion The file starts with a header holding the format version, the content version and the counts, followed by a table of unique
+ *  strings and the contact records, which reference strings by index. Reads memory-map the file. Thumbnail photos are not stored, and only
+ *  NSString and NSNumber custom property values are stored.
+ */
+@interface OHContactsSnapshotStore : NSObject
+
+/**
+ *  Creates the snapshot store
+ *
+ *  @param fileURL        Location of the snapshot file
+ *  @param contentVersion Version of the processed content, bump it when the post processors change so that older snapshots are ignored
+ */
+- (instancetype)initWithFileURL:(NSURL *)fileURL contentVersion:(uint32_t)contentVersion NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Location of the snapshot file
+ */
+@property (nonatomic, readonly) NSURL *fileURL;
+
+/**
+ *  Version of the processed content
+ */
+@property (nonatomic, readonly) uint32_t contentVersion;
+
+/**
+ *  Reads the snapshot
+ *
+ *  @return The stored contacts, or nil if there is no snapshot or it cannot be used
+ */
+- (NSOrderedSet<OHContact *> *_Nullable)readContactsWithError:(NSError *_Nullable *_Nullable)error;
+
+/**
+ *  Writes a snapshot, replacing the previous one atomically
+ */
+- (BOOL)writeContacts:(NSOrderedSet<OHContact *> *)contacts error:(NSError *_Nullable *_Nullable)error;
+
+/**
+ *  Encodes and writes the snapshot on a background queue
+ *
+ *  @discussion The contacts, their fields and their addresses are copied on the calling thread, so they may be modified as soon as this
+ *  returns
+ *
+ *  @param completion Called on the background queue once the snapshot is written (optional)
+ */
+- (void)writeContacts:(NSOrderedSet<OHContact *> *)contacts completion:(void (^_Nullable)(NSError *_Nullable error))completion;
+
+/**
+ *  Deletes the snapshot
+ */
+- (void)removeSnapshot;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,493 @@
+//
+//  OHContactsSnapshotStore.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import "OHContactsSnapshotStore.h"
+
+NSString *const OHContactsSnapshotStoreErrorDomain = @"com.uber.ohana.snapshotstore";
+
+static const uint8_t kOHContactsSnapshotMagic[4] = { 'O', 'H', 'C', 'S' };
+static const uint32_t kOHContactsSnapshotFormatVersion = 1;
+
+/**
+ *  Kinds of custom property values
+ */
+typedef NS_ENUM(uint8_t, OHContactsSnapshotValueKind) {
+    OHContactsSnapshotValueKindString,
+    OHContactsSnapshotValueKindInteger,
+    OHContactsSnapshotValueKindFloat,
+    OHContactsSnapshotValueKindBool
+};
+
+/**
+ *  Bounds checked cursor over the snapshot bytes, reads past the end set failed and return zero
+ */
+typedef struct {
+    const uint8_t *bytes;
+    NSUInteger length;
+    NSUInteger offset;
+    BOOL failed;
+} OHContactsSnapshotReader;
+
+static BOOL OHContactsSnapshotReaderCanRead(OHContactsSnapshotReader *reader, NSUInteger length)
+{
+    if (reader->failed || reader->length - reader->offset < length) {
+        reader->failed = YES;
+        return NO;
+    }
+    return YES;
+}
+
+static uint8_t OHContactsSnapshotReadUInt8(OHContactsSnapshotReader *reader)
+{
+    if (!OHContactsSnapshotReaderCanRead(reader, sizeof(uint8_t))) {
+        return 0;
+    }
+    return reader->bytes[reader->offset++];
+}
+
+static uint32_t OHContactsSnapshotReadUInt32(OHContactsSnapshotReader *reader)
+{
+    if (!OHContactsSnapshotReaderCanRead(reader, sizeof(uint32_t))) {
+        return 0;
+    }
+    uint32_t value;
+    memcpy(&value, reader->bytes + reader->offset, sizeof(value));
+    reader->offset += sizeof(value);
+    return OSSwapLittleToHostInt32(value);
+}
+
+static uint64_t OHContactsSnapshotReadUInt64(OHContactsSnapshotReader *reader)
+{
+    if (!OHContactsSnapshotReaderCanRead(reader, sizeof(uint64_t))) {
+        return 0;
+    }
+    uint64_t value;
+    memcpy(&value, reader->bytes + reader->offset, sizeof(value));
+    reader->offset += sizeof(value);
+    return OSSwapLittleToHostInt64(value);
+}
+
+static void OHContactsSnapshotAppendUInt8(NSMutableData *data, uint8_t value)
+{
+    [data appendBytes:&value length:sizeof(value)];
+}
+
+static void OHContactsSnapshotAppendUInt32(NSMutableData *data, uint32_t value)
+{
+    value = OSSwapHostToLittleInt32(value);
+    [data appendBytes:&value length:sizeof(value)];
+}
+
+static void OHContactsSnapshotAppendUInt64(NSMutableData *data, uint64_t value)
+{
+    value = OSSwapHostToLittleInt64(value);
+    [data appendBytes:&value length:sizeof(value)];
+}
+
+/**
+ *  Encodes contacts, collecting every string into a table of unique strings referenced by index + 1 (0 stands for nil)
+ */
+@interface OHContactsSnapshotEncoder : NSObject
+
+@property (nonatomic) NSMutableData *records;
+@property (nonatomic) NSMutableArray<NSString *> *strings;
+@property (nonatomic) NSMutableDictionary<NSString *, NSNumber *> *stringReferences;
+
+@end
+
+@implementation OHContactsSnapshotEncoder
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _records = [[NSMutableData alloc] init];
+        _strings = [[NSMutableArray<NSString *> alloc] init];
+        _stringReferences = [[NSMutableDictionary<NSString *, NSNumber *> alloc] init];
+    }
+    return self;
+}
+
+- (void)appendString:(NSString *)string
+{
+    if (![string isKindOfClass:[NSString class]]) {
+        OHContactsSnapshotAppendUInt32(self.records, 0);
+        return;
+    }
+    NSNumber *reference = [self.stringReferences objectForKey:string];
+    if (!reference) {
+        [self.strings addObject:string];
+        reference = @(self.strings.count);
+        [self.stringReferences setObject:reference forKey:string];
+    }
+    OHContactsSnapshotAppendUInt32(self.records, reference.unsignedIntValue);
+}
+
+- (void)appendTags:(NSSet<NSString *> *)tags
+{
+    OHContactsSnapshotAppendUInt32(self.records, (uint32_t)tags.count);
+    for (NSString *tag in tags) {
+        [self appendString:tag];
+    }
+}
+
+- (void)appendCustomProperties:(NSDictionary<NSString *, id> *)customProperties
+{
+    NSMutableArray<NSString *> *keys = [[NSMutableArray<NSString *> alloc] initWithCapacity:customProperties.count];
+    [customProperties enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+        if ([key isKindOfClass:[NSString class]] && ([value isKindOfClass:[NSString class]] || [value isKindOfClass:[NSNumber class]])) {
+            [keys addObject:key];
+        }
+    }];
+
+    OHContactsSnapshotAppendUInt32(self.records, (uint32_t)keys.count);
+    for (NSString *key in keys) {
+        id value = [customProperties objectForKey:key];
+        [self appendString:key];
+        if ([value isKindOfClass:[NSString class]]) {
+            OHContactsSnapshotAppendUInt8(self.records, OHContactsSnapshotValueKindString);
+            [self appendString:value];
+        } else if (CFGetTypeID((__bridge CFTypeRef)value) == CFBooleanGetTypeID()) {
+            OHContactsSnapshotAppendUInt8(self.records, OHContactsSnapshotValueKindBool);
+            OHContactsSnapshotAppendUInt64(self.records, [value boolValue]);
+        } else if (CFNumberIsFloatType((__bridge CFNumberRef)value)) {
+            OHContactsSnapshotAppendUInt8(self.records, OHContactsSnapshotValueKindFloat);
+            double doubleValue = [value doubleValue];
+            uint64_t bits;
+            memcpy(&bits, &doubleValue, sizeof(bits));
+            OHContactsSnapshotAppendUInt64(self.records, bits);
+        } else {
+            OHContactsSnapshotAppendUInt8(self.records, OHContactsSnapshotValueKindInteger);
+            OHContactsSnapshotAppendUInt64(self.records, (uint64_t)[value longLongValue]);
+        }
+    }
+}
+
+- (void)appendContact:(OHContact *)contact
+{
+    [self appendString:contact.fullName];
+    [self appendString:contact.firstName];
+    [self appendString:contact.lastName];
+    [self appendString:contact.organizationName];
+    [self appendString:contact.jobTitle];
+    [self appendString:contact.departmentName];
+
+    OHContactsSnapshotAppendUInt32(self.records, (uint32_t)contact.contactFields.count);
+    for (OHContactField *contactField in contact.contactFields) {
+        OHContactsSnapshotAppendUInt32(self.records, (uint32_t)contactField.type);
+        [self appendString:contactField.label];
+        [self appendString:contactField.value];
+        [self appendString:contactField.dataProviderIdentifier];
+        [self appendTags:contactField.tags];
+        [self appendCustomProperties:contactField.customProperties];
+    }
+
+    OHContactsSnapshotAppendUInt32(self.records, (uint32_t)contact.postalAddresses.count);
+    for (OHContactAddress *postalAddress in contact.postalAddresses) {
+        [self appendString:postalAddress.label];
+        [self appendString:postalAddress.street];
+        [self appendString:postalAddress.city];
+        [self appendString:postalAddress.state];
+        [self appendString:postalAddress.postalCode];
+        [self appendString:postalAddress.country];
+        [self appendString:postalAddress.dataProviderIdentifier];
+        [self appendTags:postalAddress.tags];
+        [self appendCustomProperties:postalAddress.customProperties];
+    }
+
+    [self appendTags:contact.tags];
+    [self appendCustomProperties:contact.customProperties];
+}
+
+- (NSData *)snapshotDataWithContactCount:(NSUInteger)contactCount contentVersion:(uint32_t)contentVersion
+{
+    NSMutableData *data = [[NSMutableData alloc] initWithCapacity:self.records.length + self.strings.count * 16];
+    [data appendBytes:kOHContactsSnapshotMagic length:sizeof(kOHContactsSnapshotMagic)];
+    OHContactsSnapshotAppendUInt32(data, kOHContactsSnapshotFormatVersion);
+    OHContactsSnapshotAppendUInt32(data, contentVersion);
+    OHContactsSnapshotAppendUInt32(data, (uint32_t)self.strings.count);
+    OHContactsSnapshotAppendUInt32(data, (uint32_t)contactCount);
+    for (NSString *string in self.strings) {
+        NSData *stringData = [string dataUsingEncoding:NSUTF8StringEncoding];
+        OHContactsSnapshotAppendUInt32(data, (uint32_t)stringData.length);
+        [data appendData:stringData];
+    }
+    [data appendData:self.records];
+    return data;
+}
+
+@end
+
+@interface OHContactsSnapshotStore ()
+
+@property (nonatomic) dispatch_queue_t writingQueue;
+
+@end
+
+@implementation OHContactsSnapshotStore
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL contentVersion:(uint32_t)contentVersion
+{
+    if (self = [super init]) {
+        _fileURL = fileURL;
+        _contentVersion = contentVersion;
+        _writingQueue = dispatch_queue_create("com.uber.ohana.snapshotstore", DISPATCH_QUEUE_SERIAL);
+    }
+    return self;
+}
+
+- (NSOrderedSet<OHContact *> *)readContactsWithError:(NSError **)error
+{
+    NSData *data = [NSData dataWithContentsOfURL:self.fileURL options:NSDataReadingMappedIfSafe error:error];
+    if (!data) {
+        return nil;
+    }
+
+    OHContactsSnapshotReader reader = { .bytes = data.bytes, .length = data.length, .offset = 0, .failed = NO };
+    if (!OHContactsSnapshotReaderCanRead(&reader, sizeof(kOHContactsSnapshotMagic)) || memcmp(reader.bytes, kOHContactsSnapshotMagic, sizeof(kOHContactsSnapshotMagic))) {
+        [self _setError:error code:OHContactsSnapshotStoreErrorCodeCorrupted];
+        return nil;
+    }
+    reader.offset += sizeof(kOHContactsSnapshotMagic);
+
+    uint32_t formatVersion = OHContactsSnapshotReadUInt32(&reader);
+    uint32_t contentVersion = OHContactsSnapshotReadUInt32(&reader);
+    if (!reader.failed && (formatVersion != kOHContactsSnapshotFormatVersion || contentVersion != self.contentVersion)) {
+        [self _setError:error code:OHContactsSnapshotStoreErrorCodeVersionMismatch];
+        return nil;
+    }
+
+    uint32_t stringCount = OHContactsSnapshotReadUInt32(&reader);
+    uint32_t contactCount = OHContactsSnapshotReadUInt32(&reader);
+    // Every string takes at least its length, which bounds the allocation for corrupted counts
+    if (reader.failed || stringCount > (reader.length - reader.offset) / sizeof(uint32_t)) {
+        [self _setError:error code:OHContactsSnapshotStoreErrorCodeCorrupted];
+        return nil;
+    }
+
+    NSMutableArray<NSString *> *strings = [[NSMutableArray<NSString *> alloc] initWithCapacity:stringCount];
+    for (uint32_t i = 0; i < stringCount && !reader.failed; i++) {
+        uint32_t length = OHContactsSnapshotReadUInt32(&reader);
+        if (!OHContactsSnapshotReaderCanRead(&reader, length)) {
+            break;
+        }
+        NSString *string = [[NSString alloc] initWithBytes:reader.bytes + reader.offset length:length encoding:NSUTF8StringEncoding];
+        if (!string) {
+            reader.failed = YES;
+            break;
+        }
+        [strings addObject:string];
+        reader.offset += length;
+    }
+
+    NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] init];
+    for (uint32_t i = 0; i < contactCount && !reader.failed; i++) {
+        OHContact *contact = [self _readContactWithReader:&reader strings:strings];
+        if (contact) {
+            [contacts addObject:contact];
+        }
+    }
+
+    if (reader.failed) {
+        [self _setError:error code:OHContactsSnapshotStoreErrorCodeCorrupted];
+        return nil;
+    }
+    return contacts;
+}
+
+- (BOOL)writeContacts:(NSOrderedSet<OHContact *> *)contacts error:(NSError **)error
+{
+    return [[self _snapshotDataForContacts:contacts.array] writeToURL:self.fileURL options:NSDataWritingAtomic error:error];
+}
+
+- (void)writeContacts:(NSOrderedSet<OHContact *> *)contacts completion:(void (^)(NSError *))completion
+{
+    // Copying a contact is much cheaper than encoding it, and leaves the caller free to modify the contacts once this returns
+    NSMutableArray<OHContact *> *contactCopies = [[NSMutableArray<OHContact *> alloc] initWithCapacity:contacts.count];
+    for (OHContact *contact in contacts) {
+        [contactCopies addObject:[self _deepCopyOfContact:contact]];
+    }
+    dispatch_async(self.writingQueue, ^{
+        NSError *error = nil;
+        [[self _snapshotDataForContacts:contactCopies] writeToURL:self.fileURL options:NSDataWritingAtomic error:&error];
+        if (completion) {
+            completion(error);
+        }
+    });
+}
+
+- (void)removeSnapshot
+{
+    dispatch_sync(self.writingQueue, ^{
+        [[NSFileManager defaultManager] removeItemAtURL:self.fileURL error:nil];
+    });
+}
+
+#pragma mark - Private
+
+/**
+ *  Copies the contact along with its fields and addresses, since a contact copy shares them, and post processors such as phone number
+ *  formatting write into their tags and custom properties while the writing queue encodes them
+ */
+- (OHContact *)_deepCopyOfContact:(OHContact *)contact
+{
+    OHContact *contactCopy = [contact copy];
+    if (contact.contactFields) {
+        NSMutableOrderedSet<OHContactField *> *contactFields = [[NSMutableOrderedSet<OHContactField *> alloc] initWithCapacity:contact.contactFields.count];
+        for (OHContactField *contactField in contact.contactFields) {
+            [contactFields addObject:[contactField copy]];
+        }
+        contactCopy.contactFields = contactFields;
+    }
+    if (contact.postalAddresses) {
+        NSMutableOrderedSet<OHContactAddress *> *postalAddresses = [[NSMutableOrderedSet<OHContactAddress *> alloc] initWithCapacity:contact.postalAddresses.count];
+        for (OHContactAddress *postalAddress in contact.postalAddresses) {
+            [postalAddresses addObject:[postalAddress copy]];
+        }
+        contactCopy.postalAddresses = postalAddresses;
+    }
+    return contactCopy;
+}
+
+- (NSData *)_snapshotDataForContacts:(NSArray<OHContact *> *)contacts
+{
+    OHContactsSnapshotEncoder *encoder = [[OHContactsSnapshotEncoder alloc] init];
+    for (OHContact *contact in contacts) {
+        [encoder appendContact:contact];
+    }
+    return [encoder snapshotDataWithContactCount:contacts.count contentVersion:self.contentVersion];
+}
+
+- (void)_setError:(NSError **)error code:(OHContactsSnapshotStoreErrorCode)code
+{
+    if (error) {
+        *error = [NSError errorWithDomain:OHContactsSnapshotStoreErrorDomain code:code userInfo:nil];
+    }
+}
+
+- (NSString *)_readStringWithReader:(OHContactsSnapshotReader *)reader strings:(NSArray<NSString *> *)strings
+{
+    uint32_t reference = OHContactsSnapshotReadUInt32(reader);
+    if (!reference) {
+        return nil;
+    }
+    if (reference > strings.count) {
+        reader->failed = YES;
+        return nil;
+    }
+    return [strings objectAtIndex:reference - 1];
+}
+
+- (void)_readTagsIntoSet:(NSMutableSet<NSString *> *)tags reader:(OHContactsSnapshotReader *)reader strings:(NSArray<NSString *> *)strings
+{
+    uint32_t count = OHContactsSnapshotReadUInt32(reader);
+    for (uint32_t i = 0; i < count && !reader->failed; i++) {
+        NSString *tag = [self _readStringWithReader:reader strings:strings];
+        if (tag) {
+            [tags addObject:tag];
+        }
+    }
+}
+
+- (void)_readCustomPropertiesIntoDictionary:(NSMutableDictionary<NSString *, id> *)customProperties reader:(OHContactsSnapshotReader *)reader strings:(NSArray<NSString *> *)strings
+{
+    uint32_t count = OHContactsSnapshotReadUInt32(reader);
+    for (uint32_t i = 0; i < count && !reader->failed; i++) {
+        NSString *key = [self _readStringWithReader:reader strings:strings];
+        id value = nil;
+        switch ((OHContactsSnapshotValueKind)OHContactsSnapshotReadUInt8(reader)) {
+            case OHContactsSnapshotValueKindString:
+                value = [self _readStringWithReader:reader strings:strings];
+                break;
+            case OHContactsSnapshotValueKindInteger:
+                value = @((long long)OHContactsSnapshotReadUInt64(reader));
+                break;
+            case OHContactsSnapshotValueKindFloat: {
+                uint64_t bits = OHContactsSnapshotReadUInt64(reader);
+                double doubleValue;
+                memcpy(&doubleValue, &bits, sizeof(doubleValue));
+                value = @(doubleValue);
+                break;
+            }
+            case OHContactsSnapshotValueKindBool:
+                value = @(OHContactsSnapshotReadUInt64(reader) != 0);
+                break;
+            default:
+                reader->failed = YES;
+                break;
+        }
+        if (key && value) {
+            [customProperties setObject:value forKey:key];
+        }
+    }
+}
+
+- (OHContact *)_readContactWithReader:(OHContactsSnapshotReader *)reader strings:(NSArray<NSString *> *)strings
+{
+    OHContact *contact = [[OHContact alloc] init];
+    contact.fullName = [self _readStringWithReader:reader strings:strings];
+    contact.firstName = [self _readStringWithReader:reader strings:strings];
+    contact.lastName = [self _readStringWithReader:reader strings:strings];
+    contact.organizationName = [self _readStringWithReader:reader strings:strings];
+    contact.jobTitle = [self _readStringWithReader:reader strings:strings];
+    contact.departmentName = [self _readStringWithReader:reader strings:strings];
+
+    uint32_t contactFieldCount = OHContactsSnapshotReadUInt32(reader);
+    NSMutableOrderedSet<OHContactField *> *contactFields = [[NSMutableOrderedSet<OHContactField *> alloc] init];
+    for (uint32_t i = 0; i < contactFieldCount && !reader->failed; i++) {
+        OHContactFieldType type = (OHContactFieldType)OHContactsSnapshotReadUInt32(reader);
+        NSString *label = [self _readStringWithReader:reader strings:strings];
+        NSString *value = [self _readStringWithReader:reader strings:strings];
+        NSString *dataProviderIdentifier = [self _readStringWithReader:reader strings:strings];
+        OHContactField *contactField = [[OHContactField alloc] initWithType:type label:label ?: @"" value:value ?: @"" dataProviderIdentifier:dataProviderIdentifier ?: @""];
+        [self _readTagsIntoSet:contactField.tags reader:reader strings:strings];
+        [self _readCustomPropertiesIntoDictionary:contactField.customProperties reader:reader strings:strings];
+        [contactFields addObject:contactField];
+    }
+    contact.contactFields = contactFields;
+
+    uint32_t postalAddressCount = OHContactsSnapshotReadUInt32(reader);
+    NSMutableOrderedSet<OHContactAddress *> *postalAddresses = [[NSMutableOrderedSet<OHContactAddress *> alloc] init];
+    for (uint32_t i = 0; i < postalAddressCount && !reader->failed; i++) {
+        NSString *label = [self _readStringWithReader:reader strings:strings];
+        NSString *street = [self _readStringWithReader:reader strings:strings];
+        NSString *city = [self _readStringWithReader:reader strings:strings];
+        NSString *state = [self _readStringWithReader:reader strings:strings];
+        NSString *postalCode = [self _readStringWithReader:reader strings:strings];
+        NSString *country = [self _readStringWithReader:reader strings:strings];
+        NSString *dataProviderIdentifier = [self _readStringWithReader:reader strings:strings];
+        OHContactAddress *postalAddress = [[OHContactAddress alloc] initWithLabel:label ?: @"" street:street ?: @"" city:city ?: @"" state:state ?: @"" postalCode:postalCode ?: @"" country:country ?: @"" dataProviderIdentifier:dataProviderIdentifier ?: @""];
+        [self _readTagsIntoSet:postalAddress.tags reader:reader strings:strings];
+        [self _readCustomPropertiesIntoDictionary:postalAddress.customProperties reader:reader strings:strings];
+        [postalAddresses addObject:postalAddress];
+    }
+    contact.postalAddresses = postalAddresses;
+
+    [self _readTagsIntoSet:contact.tags reader:reader strings:strings];
+    [self _readCustomPropertiesIntoDictionary:contact.customProperties reader:reader strings:strings];
+    return reader->failed ? nil : contact;
+}
+
+@end
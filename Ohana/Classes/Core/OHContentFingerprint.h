@@ -0,0 +1,72 @@
+//
+//  OHContentFingerprint.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import <Foundation/Foundation.h>
+#if TARGET_OS_IPHONE
+#import <UIKit/UIKit.h>
+#endif
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  64-bit content fingerprints used for fast equality checks on contacts, contact fields and contact addresses
+ *
+ *  @discussion Fingerprints are FNV-1a hashes, they are stable within a process but are not meant to be persisted across versions of the library.
+ *  Objects with different fingerprints are never equal, so a fingerprint comparison rejects most unequal objects without comparing their content.
+ */
+typedef uint64_t OHContentFingerprint;
+
+/**
+ *  Fingerprint of an empty input, used as the seed when combining fingerprints
+ */
+FOUNDATION_EXTERN const OHContentFingerprint kOHContentFingerprintSeed;
+
+/**
+ *  Mixes a fingerprint into an accumulated fingerprint, the result depends on the order in which fingerprints are combined
+ */
+FOUNDATION_EXTERN OHContentFingerprint OHContentFingerprintCombine(OHContentFingerprint fingerprint, OHContentFingerprint otherFingerprint);
+
+/**
+ *  Fingerprint of the UTF-16 code units of a string, nil and empty strings have different fingerprints
+ */
+FOUNDATION_EXTERN OHContentFingerprint OHContentFingerprintOfString(NSString *_Nullable string);
+
+/**
+ *  Fingerprint of the bytes of a data object
+ */
+FOUNDATION_EXTERN OHContentFingerprint OHContentFingerprintOfData(NSData *_Nullable data);
+
+#if TARGET_OS_IPHONE
+/**
+ *  Fingerprint of the raw pixel data of an image, without encoding it
+ *
+ *  @discussion Images with the same pixels in different bitmap layouts have different fingerprints. Images that are not backed by a CGImage
+ *  fall back to the fingerprint of their PNG representation.
+ */
+FOUNDATION_EXTERN OHContentFingerprint OHContentFingerprintOfImage(UIImage *_Nullable image);
+#endif
+
+NS_ASSUME_NONNULL_END
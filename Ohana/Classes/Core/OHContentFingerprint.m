@@ -0,0 +1,107 @@
+//
+//  OHContentFingerprint.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#import "OHContentFingerprint.h"
+
+const OHContentFingerprint kOHContentFingerprintSeed = 0xcbf29ce484222325ULL;
+
+static const OHContentFingerprint kOHContentFingerprintPrime = 0x100000001b3ULL;
+
+/**
+ *  Fingerprint of nil, distinct from the fingerprint of any empty value
+ */
+static const OHContentFingerprint kOHContentFingerprintNil = 0x9e3779b97f4a7c15ULL;
+
+static inline OHContentFingerprint OHContentFingerprintAppendBytes(OHContentFingerprint fingerprint, const uint8_t *bytes, NSUInteger length)
+{
+    for (NSUInteger i = 0; i < length; i++) {
+        fingerprint ^= bytes[i];
+        fingerprint *= kOHContentFingerprintPrime;
+    }
+    return fingerprint;
+}
+
+OHContentFingerprint OHContentFingerprintCombine(OHContentFingerprint fingerprint, OHContentFingerprint otherFingerprint)
+{
+    return OHContentFingerprintAppendBytes(fingerprint, (const uint8_t *)&otherFingerprint, sizeof(otherFingerprint));
+}
+
+OHContentFingerprint OHContentFingerprintOfString(NSString *string)
+{
+    if (!string) {
+        return kOHContentFingerprintNil;
+    }
+
+    NSUInteger length = string.length;
+    OHContentFingerprint fingerprint = OHContentFingerprintAppendBytes(kOHContentFingerprintSeed, (const uint8_t *)&length, sizeof(length));
+    const UniChar *characters = CFStringGetCharactersPtr((__bridge CFStringRef)string);
+    if (characters) {
+        return OHContentFingerprintAppendBytes(fingerprint, (const uint8_t *)characters, length * sizeof(UniChar));
+    }
+
+    // Strings that are not stored as UTF-16 are copied out in chunks rather than all at once
+    UniChar buffer[128];
+    for (NSUInteger location = 0; location < length; location += 128) {
+        NSRange range = NSMakeRange(location, MIN((NSUInteger)128, length - location));
+        [string getCharacters:buffer range:range];
+        fingerprint = OHContentFingerprintAppendBytes(fingerprint, (const uint8_t *)buffer, range.length * sizeof(UniChar));
+    }
+    return fingerprint;
+}
+
+OHContentFingerprint OHContentFingerprintOfData(NSData *data)
+{
+    if (!data) {
+        return kOHContentFingerprintNil;
+    }
+
+    __block OHContentFingerprint fingerprint = kOHContentFingerprintSeed;
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        fingerprint = OHContentFingerprintAppendBytes(fingerprint, bytes, byteRange.length);
+    }];
+    return fingerprint;
+}
+
+#if TARGET_OS_IPHONE
+OHContentFingerprint OHContentFingerprintOfImage(UIImage *image)
+{
+    if (!image) {
+        return kOHContentFingerprintNil;
+    }
+
+    CGImageRef cgImage = image.CGImage;
+    CFDataRef pixelData = cgImage ? CGDataProviderCopyData(CGImageGetDataProvider(cgImage)) : NULL;
+    if (!pixelData) {
+        return OHContentFingerprintOfData(UIImagePNGRepresentation(image));
+    }
+
+    size_t dimensions[] = { CGImageGetWidth(cgImage), CGImageGetHeight(cgImage), CGImageGetBytesPerRow(cgImage), CGImageGetBitsPerPixel(cgImage), CGImageGetBitmapInfo(cgImage) };
+    OHContentFingerprint fingerprint = OHContentFingerprintAppendBytes(kOHContentFingerprintSeed, (const uint8_t *)dimensions, sizeof(dimensions));
+    fingerprint = OHContentFingerprintAppendBytes(fingerprint, CFDataGetBytePtr(pixelData), (NSUInteger)CFDataGetLength(pixelData));
+    CFRelease(pixelData);
+    return fingerprint;
+}
+#endif
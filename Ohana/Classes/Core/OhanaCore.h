@@ -26,7 +26,17 @@
 #import <Ohana/OHContact.h>
 #import <Ohana/OHContactAddress.h>
 #import <Ohana/OHContactField.h>
+#import <Ohana/OHContactProjection.h>
+#import <Ohana/OHContactsChangeSourceProtocol.h>
 #import <Ohana/OHContactsDataProviderProtocol.h>
 #import <Ohana/OHContactsDataSource.h>
+#import <Ohana/OHContactsDataSourceChange.h>
+#import <Ohana/OHContactsDataSourceMetrics.h>
+#import <Ohana/OHContactsDataSourceTracingProtocol.h>
+#import <Ohana/OHContactsIndexVector.h>
+#import <Ohana/OHContactsIndexVectorPostProcessorProtocol.h>
+#import <Ohana/OHContactsMerger.h>
 #import <Ohana/OHContactsPostProcessorProtocol.h>
 #import <Ohana/OHContactsSelectionFilterProtocol.h>
+#import <Ohana/OHContactsSnapshotStore.h>
+#import <Ohana/OHContentFingerprint.h>
@@ -0,0 +1,81 @@
+//
+//  OHDigitSearchUtility.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "OHContact.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, OHDigitSearchMode) {
+    OHDigitSearchModeSubstring, // The digits appear anywhere in a phone number, or in a word of a name
+    OHDigitSearchModePrefix,    // A phone number, or a word of a name, starts with the digits
+    OHDigitSearchModeSuffix     // A phone number, or a word of a name, ends with the digits
+};
+
+/**
+ *  Dialer style search of contacts by typed digits
+ *
+ *  @discussion Phone numbers are indexed by their digits only, so "4155" finds "(415) 555-1234". Names are indexed by their T9 digits,
+ *  with each letter replaced by the key it is on (abc is 2, def is 3, and so on), after folding case and diacritics. Both indexes are
+ *  suffix arrays built in initWithContacts:, so a lookup is a binary search whose cost depends on the length of the digits and the
+ *  number of matches rather than the size of the book. The utility is immutable and can be queried from any thread.
+ */
+@interface OHDigitSearchUtility : NSObject
+
+/**
+ *  @param contacts Set of contacts to search
+ */
+- (instancetype)initWithContacts:(NSOrderedSet<OHContact *> *)contacts NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Returns the contacts with a phone number matching the digits, in their original order
+ *
+ *  @param digits Digits to search for, characters other than ASCII digits are ignored
+ */
+- (NSOrderedSet<OHContact *> *)contactsMatchingDigits:(NSString *)digits mode:(OHDigitSearchMode)mode;
+
+/**
+ *  Returns the phone number contact fields matching the digits, in the order of the contacts and their contact fields
+ *
+ *  @param digits Digits to search for, characters other than ASCII digits are ignored
+ */
+- (NSArray<OHContactField *> *)contactFieldsMatchingDigits:(NSString *)digits mode:(OHDigitSearchMode)mode;
+
+/**
+ *  Returns the contacts with a word of their name matching the T9 digits, in their original order
+ *
+ *  @discussion Names are the full name, or the first and last names if the contact has no full name. Any character that is not a
+ *  letter or a digit separates words.
+ *
+ *  @param digits Digits to search for, characters other than ASCII digits are ignored
+ */
+- (NSOrderedSet<OHContact *> *)contactsMatchingT9Digits:(NSString *)digits mode:(OHDigitSearchMode)mode;
+
+@end
+
+NS_ASSUME_NONNULL_END
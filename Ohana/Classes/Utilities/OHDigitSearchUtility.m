@@ -0,0 +1,376 @@
+//
+//  OHDigitSearchUtility.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHDigitSearchUtility.h"
+
+/**
+ *  Ends every phone number and every word of a name in the indexed text, sorts before every digit
+ */
+static const uint8_t kOHDigitSearchSeparator = 0;
+
+/**
+ *  Key of each letter from a to z on a phone keypad
+ */
+static const char kOHDigitSearchT9Keys[] = "22233344455566677778889999";
+
+/**
+ *  Compares two suffixes up to the end of the phone number or word they start in
+ */
+static int OHDigitSearchCompareSuffixes(const uint8_t *text, uint32_t position1, uint32_t position2)
+{
+    const uint8_t *suffix1 = text + position1;
+    const uint8_t *suffix2 = text + position2;
+    while (*suffix1 == *suffix2 && *suffix1 != kOHDigitSearchSeparator) {
+        suffix1++;
+        suffix2++;
+    }
+    return (int)*suffix1 - (int)*suffix2;
+}
+
+/**
+ *  Sorts suffix positions with a bottom up merge sort, using scratch as a buffer of the same size
+ */
+static void OHDigitSearchSortSuffixes(const uint8_t *text, uint32_t *positions, uint32_t *scratch, NSUInteger count)
+{
+    uint32_t *source = positions;
+    uint32_t *destination = scratch;
+    for (NSUInteger width = 1; width < count; width *= 2) {
+        for (NSUInteger start = 0; start < count; start += 2 * width) {
+            NSUInteger middle = MIN(start + width, count);
+            NSUInteger end = MIN(start + 2 * width, count);
+            NSUInteger left = start;
+            NSUInteger right = middle;
+            NSUInteger output = start;
+            while (left < middle && right < end) {
+                destination[output++] = OHDigitSearchCompareSuffixes(text, source[right], source[left]) < 0 ? source[right++] : source[left++];
+            }
+            while (left < middle) {
+                destination[output++] = source[left++];
+            }
+            while (right < end) {
+                destination[output++] = source[right++];
+            }
+        }
+        uint32_t *swap = source;
+        source = destination;
+        destination = swap;
+    }
+    if (source != positions) {
+        memcpy(positions, source, count * sizeof(uint32_t));
+    }
+}
+
+/**
+ *  Compares the start of a suffix with the digits, a suffix whose phone number or word ends first is smaller
+ */
+static int OHDigitSearchCompareSuffixWithDigits(const uint8_t *text, uint32_t position, const uint8_t *digits, NSUInteger length)
+{
+    for (NSUInteger i = 0; i < length; i++) {
+        uint8_t character = text[position + i];
+        if (character != digits[i]) {
+            return (int)character - (int)digits[i];
+        }
+    }
+    return 0;
+}
+
+static NSData *OHDigitSearchDigitsOfString(NSString *string)
+{
+    NSUInteger length = string.length;
+    NSMutableData *characterData = [[NSMutableData alloc] initWithLength:length * sizeof(unichar)];
+    unichar *characters = characterData.mutableBytes;
+    [string getCharacters:characters range:NSMakeRange(0, length)];
+
+    NSMutableData *digits = [[NSMutableData alloc] initWithCapacity:length];
+    for (NSUInteger i = 0; i < length; i++) {
+        if (characters[i] >= '0' && characters[i] <= '9') {
+            uint8_t digit = (uint8_t)characters[i];
+            [digits appendBytes:&digit length:1];
+        }
+    }
+    return digits;
+}
+
+/**
+ *  Suffix array over a text of digits, split into entries that each end with a separator
+ */
+@interface OHDigitSuffixArray : NSObject
+
+- (instancetype)initWithText:(NSData *)text entryStarts:(NSData *)entryStarts;
+
+/**
+ *  Indexes of the entries with a phone number or word matching the digits
+ */
+- (NSIndexSet *)entryIndexesMatchingDigits:(NSData *)digits mode:(OHDigitSearchMode)mode;
+
+@end
+
+@interface OHDigitSuffixArray ()
+
+@property (nonatomic) NSData *text;
+@property (nonatomic) NSData *entryStarts;  // uint32_t, ascending
+@property (nonatomic) NSData *suffixes;     // uint32_t positions of every digit in the text, sorted by the suffix starting there
+
+@end
+
+@implementation OHDigitSuffixArray
+
+- (instancetype)initWithText:(NSData *)text entryStarts:(NSData *)entryStarts
+{
+    if (self = [super init]) {
+        _text = text;
+        _entryStarts = entryStarts;
+
+        const uint8_t *textBytes = text.bytes;
+        NSMutableData *suffixes = [[NSMutableData alloc] initWithLength:text.length * sizeof(uint32_t)];
+        uint32_t *positions = suffixes.mutableBytes;
+        NSUInteger count = 0;
+        for (uint32_t position = 0; position < text.length; position++) {
+            if (textBytes[position] != kOHDigitSearchSeparator) {
+                positions[count++] = position;
+            }
+        }
+        uint32_t *scratch = malloc(MAX(count, 1) * sizeof(uint32_t));
+        OHDigitSearchSortSuffixes(textBytes, positions, scratch, count);
+        free(scratch);
+        suffixes.length = count * sizeof(uint32_t);
+        _suffixes = suffixes;
+    }
+    return self;
+}
+
+- (NSIndexSet *)entryIndexesMatchingDigits:(NSData *)digits mode:(OHDigitSearchMode)mode
+{
+    NSMutableIndexSet *entryIndexes = [[NSMutableIndexSet alloc] init];
+    NSUInteger length = digits.length;
+    if (!length) {
+        return entryIndexes;
+    }
+
+    const uint8_t *text = self.text.bytes;
+    const uint8_t *digitBytes = digits.bytes;
+    const uint32_t *suffixes = self.suffixes.bytes;
+    NSUInteger suffixCount = self.suffixes.length / sizeof(uint32_t);
+
+    // Suffixes starting with the digits are contiguous, between the first one not smaller and the first one greater
+    NSUInteger low = 0;
+    NSUInteger high = suffixCount;
+    while (low < high) {
+        NSUInteger middle = (low + high) / 2;
+        if (OHDigitSearchCompareSuffixWithDigits(text, suffixes[middle], digitBytes, length) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    NSUInteger first = low;
+    high = suffixCount;
+    while (low < high) {
+        NSUInteger middle = (low + high) / 2;
+        if (OHDigitSearchCompareSuffixWithDigits(text, suffixes[middle], digitBytes, length) <= 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    for (NSUInteger i = first; i < low; i++) {
+        uint32_t position = suffixes[i];
+        if (mode == OHDigitSearchModePrefix && position > 0 && text[position - 1] != kOHDigitSearchSeparator) {
+            continue;
+        }
+        if (mode == OHDigitSearchModeSuffix && text[position + length] != kOHDigitSearchSeparator) {
+            continue;
+        }
+        [entryIndexes addIndex:[self _entryIndexAtPosition:position]];
+    }
+    return entryIndexes;
+}
+
+#pragma mark - Private
+
+- (NSUInteger)_entryIndexAtPosition:(uint32_t)position
+{
+    const uint32_t *entryStarts = self.entryStarts.bytes;
+    NSUInteger low = 0;
+    NSUInteger high = self.entryStarts.length / sizeof(uint32_t);
+    while (low < high) {
+        NSUInteger middle = (low + high) / 2;
+        if (entryStarts[middle] <= position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low - 1;
+}
+
+@end
+
+@interface OHDigitSearchUtility ()
+
+@property (nonatomic) NSArray<OHContact *> *contacts;
+
+/**
+ *  Phone number index, with one entry per phone number contact field that has digits
+ */
+@property (nonatomic) OHDigitSuffixArray *phoneNumberIndex;
+@property (nonatomic) NSArray<OHContactField *> *phoneNumberContactFields;
+@property (nonatomic) NSData *phoneNumberContactIndexes;    // uint32_t
+
+/**
+ *  T9 name index, with one entry per contact whose name has letters or digits
+ */
+@property (nonatomic) OHDigitSuffixArray *nameIndex;
+@property (nonatomic) NSData *nameContactIndexes;           // uint32_t
+
+@end
+
+@implementation OHDigitSearchUtility
+
+- (instancetype)initWithContacts:(NSOrderedSet<OHContact *> *)contacts
+{
+    if (self = [super init]) {
+        _contacts = [[contacts copy] array];
+        [self _buildPhoneNumberIndex];
+        [self _buildNameIndex];
+    }
+    return self;
+}
+
+- (NSOrderedSet<OHContact *> *)contactsMatchingDigits:(NSString *)digits mode:(OHDigitSearchMode)mode
+{
+    NSIndexSet *entryIndexes = [self.phoneNumberIndex entryIndexesMatchingDigits:OHDigitSearchDigitsOfString(digits) mode:mode];
+    return [self _contactsForEntryIndexes:entryIndexes contactIndexes:self.phoneNumberContactIndexes];
+}
+
+- (NSArray<OHContactField *> *)contactFieldsMatchingDigits:(NSString *)digits mode:(OHDigitSearchMode)mode
+{
+    NSIndexSet *entryIndexes = [self.phoneNumberIndex entryIndexesMatchingDigits:OHDigitSearchDigitsOfString(digits) mode:mode];
+    return [self.phoneNumberContactFields objectsAtIndexes:entryIndexes];
+}
+
+- (NSOrderedSet<OHContact *> *)contactsMatchingT9Digits:(NSString *)digits mode:(OHDigitSearchMode)mode
+{
+    NSIndexSet *entryIndexes = [self.nameIndex entryIndexesMatchingDigits:OHDigitSearchDigitsOfString(digits) mode:mode];
+    return [self _contactsForEntryIndexes:entryIndexes contactIndexes:self.nameContactIndexes];
+}
+
+#pragma mark - Private
+
+- (NSOrderedSet<OHContact *> *)_contactsForEntryIndexes:(NSIndexSet *)entryIndexes contactIndexes:(NSData *)contactIndexData
+{
+    const uint32_t *contactIndexes = contactIndexData.bytes;
+    NSMutableIndexSet *matchingContactIndexes = [[NSMutableIndexSet alloc] init];
+    [entryIndexes enumerateIndexesUsingBlock:^(NSUInteger entryIndex, BOOL *stop) {
+        [matchingContactIndexes addIndex:contactIndexes[entryIndex]];
+    }];
+    return [NSOrderedSet orderedSetWithArray:[self.contacts objectsAtIndexes:matchingContactIndexes]];
+}
+
+- (void)_buildPhoneNumberIndex
+{
+    NSMutableData *text = [[NSMutableData alloc] init];
+    NSMutableData *entryStarts = [[NSMutableData alloc] init];
+    NSMutableArray<OHContactField *> *contactFields = [[NSMutableArray<OHContactField *> alloc] init];
+    NSMutableData *contactIndexes = [[NSMutableData alloc] init];
+
+    [self.contacts enumerateObjectsUsingBlock:^(OHContact *contact, NSUInteger index, BOOL *stop) {
+        if (![contact hasContactFieldOfType:OHContactFieldTypePhoneNumber]) {
+            return;
+        }
+        uint32_t contactIndex = (uint32_t)index;
+        for (OHContactField *contactField in contact.contactFields) {
+            if (contactField.type != OHContactFieldTypePhoneNumber) {
+                continue;
+            }
+            NSData *digits = OHDigitSearchDigitsOfString(contactField.value);
+            if (!digits.length) {
+                continue;
+            }
+            uint32_t entryStart = (uint32_t)text.length;
+            [entryStarts appendBytes:&entryStart length:sizeof(entryStart)];
+            [text appendData:digits];
+            [text appendBytes:&kOHDigitSearchSeparator length:1];
+            [contactFields addObject:contactField];
+            [contactIndexes appendBytes:&contactIndex length:sizeof(contactIndex)];
+        }
+    }];
+
+    self.phoneNumberIndex = [[OHDigitSuffixArray alloc] initWithText:text entryStarts:entryStarts];
+    self.phoneNumberContactFields = contactFields;
+    self.phoneNumberContactIndexes = contactIndexes;
+}
+
+- (void)_buildNameIndex
+{
+    NSMutableData *text = [[NSMutableData alloc] init];
+    NSMutableData *entryStarts = [[NSMutableData alloc] init];
+    NSMutableData *contactIndexes = [[NSMutableData alloc] init];
+    NSCharacterSet *letters = [NSCharacterSet letterCharacterSet];
+
+    [self.contacts enumerateObjectsUsingBlock:^(OHContact *contact, NSUInteger index, BOOL *stop) {
+        NSString *name = contact.fullName.length ? contact.fullName : [NSString stringWithFormat:@"%@ %@", contact.firstName ?: @"", contact.lastName ?: @""];
+        NSString *foldedName = [name stringByFoldingWithOptions:NSCaseInsensitiveSearch | NSDiacriticInsensitiveSearch locale:nil];
+
+        NSUInteger entryStart = text.length;
+        BOOL inWord = NO;
+        for (NSUInteger i = 0; i < foldedName.length; i++) {
+            unichar character = [foldedName characterAtIndex:i];
+            uint8_t key;
+            if (character >= 'a' && character <= 'z') {
+                key = (uint8_t)kOHDigitSearchT9Keys[character - 'a'];
+            } else if (character >= '0' && character <= '9') {
+                key = (uint8_t)character;
+            } else if ([letters characterIsMember:character]) {
+                // Letters that are not on the keypad are skipped without breaking the word
+                continue;
+            } else {
+                if (inWord) {
+                    [text appendBytes:&kOHDigitSearchSeparator length:1];
+                    inWord = NO;
+                }
+                continue;
+            }
+            [text appendBytes:&key length:1];
+            inWord = YES;
+        }
+        if (inWord) {
+            [text appendBytes:&kOHDigitSearchSeparator length:1];
+        }
+
+        if (text.length > entryStart) {
+            uint32_t start = (uint32_t)entryStart;
+            uint32_t contactIndex = (uint32_t)index;
+            [entryStarts appendBytes:&start length:sizeof(start)];
+            [contactIndexes appendBytes:&contactIndex length:sizeof(contactIndex)];
+        }
+    }];
+
+    self.nameIndex = [[OHDigitSuffixArray alloc] initWithText:text entryStarts:entryStarts];
+    self.nameContactIndexes = contactIndexes;
+}
+
+@end
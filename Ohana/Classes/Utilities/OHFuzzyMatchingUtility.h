@@ -29,6 +29,12 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+typedef NS_ENUM(NSInteger, OHFuzzyMatchingIndexingMode) {
+    OHFuzzyMatchingIndexingModeNone,        // Default, queries scan every name and contact field value
+    OHFuzzyMatchingIndexingModeInline,      // The index is built before the initializer returns
+    OHFuzzyMatchingIndexingModeBackground   // The index is built on a background queue, queries scan every value until it is ready
+};
+
 @interface OHFuzzyMatchingUtility : NSObject
 
 /**
@@ -36,6 +42,36 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype)initWithContacts:(NSOrderedSet<OHContact *> *)contacts;
 
+/**
+ *  @param contacts Set of contacts to run queries against
+ *  @param indexingMode How to build the index of the contacts' values
+ *
+ *  @discussion The index maps each character to the values containing it, so a query only checks the values that contain all of
+ *  its characters. It is meant for books large enough that scanning every value on each keystroke is too slow. Results are the
+ *  same with or without the index.
+ */
+- (instancetype)initWithContacts:(NSOrderedSet<OHContact *> *)contacts indexingMode:(OHFuzzyMatchingIndexingMode)indexingMode;
+
+/**
+ *  How the index is built
+ */
+@property (nonatomic, readonly) OHFuzzyMatchingIndexingMode indexingMode;
+
+/**
+ *  Whether the index has been built and is used by queries
+ */
+@property (nonatomic, readonly, getter=isIndexReady) BOOL indexReady;
+
+/**
+ *  Time it took to build the index in seconds, 0 until it is ready
+ */
+@property (nonatomic, readonly) NSTimeInterval indexBuildDuration;
+
+/**
+ *  Memory used by the index in bytes, 0 until it is ready
+ */
+@property (nonatomic, readonly) NSUInteger indexSize;
+
 typedef NSInteger (^OHFuzzyScoringBlock)(NSString *query, NSString *nominee);
 
 /**
@@ -45,13 +81,41 @@ typedef NSInteger (^OHFuzzyScoringBlock)(NSString *query, NSString *nominee);
  */
 @property (nonatomic, nullable) OHFuzzyScoringBlock scoringBlock;
 
+/**
+ *  Whether to sort results by the built-in score when no scoringBlock is set, NO by default
+ *
+ *  @discussion The built-in score rewards matched characters that follow each other, start a word, start a camel case hump or
+ *  start the value, and penalizes the characters skipped between them, in the manner of fzf. It is computed while matching, so
+ *  it costs far less than calling a scoringBlock for each matching value.
+ */
+@property (nonatomic) BOOL usesBuiltInScoring;
+
 /**
  *  Returns a copy of each contact that has full name or at least one contact field that fuzzy matches the provided query string
  *
- *  @discussion Sorted by score if scoringBlock is provided, or in their original order in allContacts if scoringBlock is nil.
+ *  @discussion Sorted by score if scoringBlock is provided or usesBuiltInScoring is set, or in their original order in allContacts
+ *  otherwise. Contacts with equal scores keep their original order.
+ *  The utility keeps a search session of recent queries: a query that extends the previous one only searches the values that
+ *  matched it, and deleting characters reuses the matches of the shorter queries typed before.
  */
 - (NSOrderedSet<OHContact *> *_Nullable)contactsMatchingQuery:(NSString *)query;
 
+/**
+ *  Returns at most limit contacts, the first ones contactsMatchingQuery: would return
+ *
+ *  @param query Query to match the contacts against
+ *  @param limit Maximum number of contacts to return, 0 for no limit
+ *
+ *  @discussion The best contacts are kept in a heap bounded by the limit as matches are found, so only the contacts returned are
+ *  ever sorted.
+ */
+- (NSOrderedSet<OHContact *> *_Nullable)contactsMatchingQuery:(NSString *)query limit:(NSUInteger)limit;
+
+/**
+ *  Forgets the queries of the search session, for example when a new search starts
+ */
+- (void)resetSearchSession;
+
 @end
 
 NS_ASSUME_NONNULL_END
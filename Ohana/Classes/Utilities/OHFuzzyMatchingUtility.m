@@ -25,10 +25,311 @@
 
 #import "OHFuzzyMatchingUtility.h"
 
+/**
+ *  Location of a nominee's folded value in the shared character buffers
+ */
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t bonusOffset;    // Offset of the value's character bonuses in the bonus buffer
+    uint32_t contactIndex;   // Position of the nominee's contact among the utility's contacts
+    BOOL isASCII;
+} OHFuzzyMatchingNomineeRange;
+
+/**
+ *  Compiled query, borrowed from an OHFuzzyMatchingQuery
+ *
+ *  @discussion A nominee matches if each token, a composed character sequence of the folded query, appears in it in order. Tokens
+ *  must appear contiguously, but anything may come between two tokens.
+ */
+typedef struct {
+    const unichar *characters;
+    const uint8_t *asciiCharacters;   // Same characters narrowed to bytes, NULL unless the folded query is ASCII
+    const uint32_t *tokenEnds;
+    NSUInteger tokenCount;
+    NSUInteger length;
+} OHFuzzyMatchingPattern;
+
+static BOOL OHFuzzyMatchingPatternMatchesASCII(const OHFuzzyMatchingPattern *pattern, const uint8_t *nominee, NSUInteger nomineeLength)
+{
+    const uint8_t *cursor = nominee;
+    const uint8_t *end = nominee + nomineeLength;
+    NSUInteger tokenStart = 0;
+    for (NSUInteger tokenIndex = 0; tokenIndex < pattern->tokenCount; tokenIndex++) {
+        NSUInteger tokenEnd = pattern->tokenEnds[tokenIndex];
+        NSUInteger tokenLength = tokenEnd - tokenStart;
+        const uint8_t *token = pattern->asciiCharacters + tokenStart;
+        while (YES) {
+            // memchr is vectorized by the C library, so long ASCII values are scanned several bytes at a time
+            const uint8_t *found = memchr(cursor, token[0], (size_t)(end - cursor));
+            if (!found || (NSUInteger)(end - found) < tokenLength) {
+                return NO;
+            }
+            if (tokenLength == 1 || memcmp(found + 1, token + 1, tokenLength - 1) == 0) {
+                cursor = found + tokenLength;
+                break;
+            }
+            cursor = found + 1;
+        }
+        tokenStart = tokenEnd;
+    }
+    return YES;
+}
+
+static BOOL OHFuzzyMatchingPatternMatchesUTF16(const OHFuzzyMatchingPattern *pattern, const unichar *nominee, NSUInteger nomineeLength)
+{
+    NSUInteger position = 0;
+    NSUInteger tokenStart = 0;
+    for (NSUInteger tokenIndex = 0; tokenIndex < pattern->tokenCount; tokenIndex++) {
+        NSUInteger tokenEnd = pattern->tokenEnds[tokenIndex];
+        NSUInteger tokenLength = tokenEnd - tokenStart;
+        const unichar *token = pattern->characters + tokenStart;
+        while (YES) {
+            while (position < nomineeLength && nominee[position] != token[0]) {
+                position++;
+            }
+            if (nomineeLength - position < tokenLength) {
+                return NO;
+            }
+            if (tokenLength == 1 || memcmp(nominee + position + 1, token + 1, (tokenLength - 1) * sizeof(unichar)) == 0) {
+                position += tokenLength;
+                break;
+            }
+            position++;
+        }
+        tokenStart = tokenEnd;
+    }
+    return YES;
+}
+
+static BOOL OHFuzzyMatchingPatternMatchesNominee(const OHFuzzyMatchingPattern *pattern, OHFuzzyMatchingNomineeRange range, const uint8_t *asciiCharacters, const unichar *characters)
+{
+    if (range.length < pattern->length) {
+        return NO;
+    }
+    if (range.isASCII) {
+        // A folded query that is not ASCII cannot appear in an ASCII value
+        return pattern->asciiCharacters && OHFuzzyMatchingPatternMatchesASCII(pattern, asciiCharacters + range.offset, range.length);
+    }
+    return OHFuzzyMatchingPatternMatchesUTF16(pattern, characters + range.offset, range.length);
+}
+
+// Scoring constants, the same as fzf's but for the prefix bonus, which ranks a value the query starts ahead of one it matches later
+static const NSInteger kOHFuzzyMatchingScoreMatch = 16;
+static const NSInteger kOHFuzzyMatchingScoreGapStart = -3;
+static const NSInteger kOHFuzzyMatchingScoreGapExtension = -1;
+static const NSInteger kOHFuzzyMatchingBonusBoundary = kOHFuzzyMatchingScoreMatch / 2;
+static const NSInteger kOHFuzzyMatchingBonusBoundaryWhite = kOHFuzzyMatchingBonusBoundary + 2;
+static const NSInteger kOHFuzzyMatchingBonusNonWord = kOHFuzzyMatchingScoreMatch / 2;
+static const NSInteger kOHFuzzyMatchingBonusCamel = kOHFuzzyMatchingBonusBoundary + kOHFuzzyMatchingScoreGapExtension;
+static const NSInteger kOHFuzzyMatchingBonusConsecutive = -(kOHFuzzyMatchingScoreGapStart + kOHFuzzyMatchingScoreGapExtension);
+static const NSInteger kOHFuzzyMatchingBonusFirstCharacterMultiplier = 2;
+static const NSInteger kOHFuzzyMatchingBonusPrefix = kOHFuzzyMatchingScoreMatch / 4;
+
+/**
+ *  Character classes in increasing order, everything after OHFuzzyMatchingCharacterClassNonWord is part of a word
+ */
+typedef NS_ENUM(uint8_t, OHFuzzyMatchingCharacterClass) {
+    OHFuzzyMatchingCharacterClassWhite,
+    OHFuzzyMatchingCharacterClassNonWord,
+    OHFuzzyMatchingCharacterClassLower,
+    OHFuzzyMatchingCharacterClassUpper,
+    OHFuzzyMatchingCharacterClassLetter,
+    OHFuzzyMatchingCharacterClassNumber
+};
+
+static OHFuzzyMatchingCharacterClass OHFuzzyMatchingClassOfCharacter(unichar character)
+{
+    if (character < 0x80) {
+        if (character >= 'a' && character <= 'z') {
+            return OHFuzzyMatchingCharacterClassLower;
+        } else if (character >= 'A' && character <= 'Z') {
+            return OHFuzzyMatchingCharacterClassUpper;
+        } else if (character >= '0' && character <= '9') {
+            return OHFuzzyMatchingCharacterClassNumber;
+        } else if (character == ' ' || (character >= '\t' && character <= '\r')) {
+            return OHFuzzyMatchingCharacterClassWhite;
+        }
+        return OHFuzzyMatchingCharacterClassNonWord;
+    }
+    if ([[NSCharacterSet lowercaseLetterCharacterSet] characterIsMember:character]) {
+        return OHFuzzyMatchingCharacterClassLower;
+    } else if ([[NSCharacterSet uppercaseLetterCharacterSet] characterIsMember:character]) {
+        return OHFuzzyMatchingCharacterClassUpper;
+    } else if ([[NSCharacterSet decimalDigitCharacterSet] characterIsMember:character]) {
+        return OHFuzzyMatchingCharacterClassNumber;
+    } else if ([[NSCharacterSet letterCharacterSet] characterIsMember:character] || [[NSCharacterSet nonBaseCharacterSet] characterIsMember:character]) {
+        return OHFuzzyMatchingCharacterClassLetter;
+    } else if ([[NSCharacterSet whitespaceAndNewlineCharacterSet] characterIsMember:character]) {
+        return OHFuzzyMatchingCharacterClassWhite;
+    }
+    return OHFuzzyMatchingCharacterClassNonWord;
+}
+
+/**
+ *  Bonus for matching a character of the given class that follows one of the previous class
+ */
+static uint8_t OHFuzzyMatchingBonus(OHFuzzyMatchingCharacterClass previousClass, OHFuzzyMatchingCharacterClass characterClass)
+{
+    if (characterClass > OHFuzzyMatchingCharacterClassNonWord) {
+        if (previousClass == OHFuzzyMatchingCharacterClassWhite) {
+            return kOHFuzzyMatchingBonusBoundaryWhite;
+        } else if (previousClass == OHFuzzyMatchingCharacterClassNonWord) {
+            return kOHFuzzyMatchingBonusBoundary;
+        }
+    }
+    if ((previousClass == OHFuzzyMatchingCharacterClassLower && characterClass == OHFuzzyMatchingCharacterClassUpper) ||
+        (previousClass != OHFuzzyMatchingCharacterClassNumber && characterClass == OHFuzzyMatchingCharacterClassNumber)) {
+        return kOHFuzzyMatchingBonusCamel;
+    }
+    if (characterClass == OHFuzzyMatchingCharacterClassNonWord) {
+        return kOHFuzzyMatchingBonusNonWord;
+    } else if (characterClass == OHFuzzyMatchingCharacterClassWhite) {
+        return kOHFuzzyMatchingBonusBoundaryWhite;
+    }
+    return 0;
+}
+
+NS_INLINE unichar OHFuzzyMatchingNomineeCharacter(OHFuzzyMatchingNomineeRange range, const uint8_t *asciiCharacters, const unichar *characters, NSUInteger position)
+{
+    return range.isASCII ? asciiCharacters[range.offset + position] : characters[range.offset + position];
+}
+
+/**
+ *  Scores a nominee the pattern is known to match
+ *
+ *  @discussion Finds the earliest end of a match, then the latest start of a match ending there, and scores the characters of
+ *  that window like fzf's first algorithm: each matched character scores its bonus, doubled for the first one, a run of
+ *  consecutive matches keeps the bonus of its first character, and each skipped character is penalized. A window starting the
+ *  value gets the prefix bonus.
+ */
+static NSInteger OHFuzzyMatchingScoreNominee(const OHFuzzyMatchingPattern *pattern, OHFuzzyMatchingNomineeRange range, const uint8_t *asciiCharacters, const unichar *characters, const uint8_t *bonuses)
+{
+    NSUInteger queryPosition = 0;
+    NSUInteger end = 0;
+    for (NSUInteger i = 0; i < range.length && queryPosition < pattern->length; i++) {
+        if (OHFuzzyMatchingNomineeCharacter(range, asciiCharacters, characters, i) == pattern->characters[queryPosition]) {
+            queryPosition++;
+            end = i + 1;
+        }
+    }
+    if (queryPosition < pattern->length) {
+        return 0;
+    }
+
+    NSUInteger start = end;
+    while (queryPosition > 0) {
+        start--;
+        if (OHFuzzyMatchingNomineeCharacter(range, asciiCharacters, characters, start) == pattern->characters[queryPosition - 1]) {
+            queryPosition--;
+        }
+    }
+
+    const uint8_t *nomineeBonuses = bonuses + range.bonusOffset;
+    NSInteger score = start == 0 ? kOHFuzzyMatchingBonusPrefix : 0;
+    NSInteger firstBonus = 0;
+    NSUInteger consecutive = 0;
+    BOOL inGap = NO;
+    for (NSUInteger i = start; i < end; i++) {
+        if (queryPosition < pattern->length && OHFuzzyMatchingNomineeCharacter(range, asciiCharacters, characters, i) == pattern->characters[queryPosition]) {
+            NSInteger bonus = nomineeBonuses[i];
+            if (consecutive == 0) {
+                firstBonus = bonus;
+            } else {
+                // A boundary inside a run starts a new run
+                if (bonus >= kOHFuzzyMatchingBonusBoundary && bonus > firstBonus) {
+                    firstBonus = bonus;
+                }
+                bonus = MAX(MAX(bonus, firstBonus), kOHFuzzyMatchingBonusConsecutive);
+            }
+            score += kOHFuzzyMatchingScoreMatch + (queryPosition == 0 ? bonus * kOHFuzzyMatchingBonusFirstCharacterMultiplier : bonus);
+            consecutive++;
+            inGap = NO;
+            queryPosition++;
+        } else {
+            score += inGap ? kOHFuzzyMatchingScoreGapExtension : kOHFuzzyMatchingScoreGapStart;
+            consecutive = 0;
+            firstBonus = 0;
+            inGap = YES;
+        }
+    }
+    return score;
+}
+
+/**
+ *  Contact and its best score, ranked by score and then by original order
+ */
+typedef struct {
+    NSInteger score;
+    uint32_t contactIndex;
+} OHFuzzyMatchingRankedContact;
+
+NS_INLINE BOOL OHFuzzyMatchingRanksBefore(OHFuzzyMatchingRankedContact contact, OHFuzzyMatchingRankedContact otherContact)
+{
+    return contact.score > otherContact.score || (contact.score == otherContact.score && contact.contactIndex < otherContact.contactIndex);
+}
+
+static int OHFuzzyMatchingCompareRankedContacts(const void *contact, const void *otherContact)
+{
+    const OHFuzzyMatchingRankedContact *rankedContact = contact;
+    const OHFuzzyMatchingRankedContact *otherRankedContact = otherContact;
+    if (OHFuzzyMatchingRanksBefore(*rankedContact, *otherRankedContact)) {
+        return -1;
+    }
+    return OHFuzzyMatchingRanksBefore(*otherRankedContact, *rankedContact) ? 1 : 0;
+}
+
+/**
+ *  Adds a contact to a heap of at most limit contacts whose root is the one ranked last, replacing the root once the heap is full
+ */
+static void OHFuzzyMatchingHeapPush(OHFuzzyMatchingRankedContact *heap, NSUInteger *count, NSUInteger limit, OHFuzzyMatchingRankedContact contact)
+{
+    NSUInteger position;
+    if (*count < limit) {
+        position = (*count)++;
+        while (position > 0) {
+            NSUInteger parent = (position - 1) / 2;
+            if (!OHFuzzyMatchingRanksBefore(heap[parent], contact)) {
+                break;
+            }
+            heap[position] = heap[parent];
+            position = parent;
+        }
+        heap[position] = contact;
+        return;
+    }
+
+    if (!OHFuzzyMatchingRanksBefore(contact, heap[0])) {
+        return;
+    }
+    position = 0;
+    while (YES) {
+        NSUInteger child = position * 2 + 1;
+        if (child >= *count) {
+            break;
+        }
+        if (child + 1 < *count && OHFuzzyMatchingRanksBefore(heap[child], heap[child + 1])) {
+            child++;
+        }
+        if (!OHFuzzyMatchingRanksBefore(contact, heap[child])) {
+            break;
+        }
+        heap[position] = heap[child];
+        position = child;
+    }
+    heap[position] = contact;
+}
+
+static NSString *OHFuzzyMatchingFoldedString(NSString *string)
+{
+    return [string stringByFoldingWithOptions:NSCaseInsensitiveSearch locale:nil];
+}
+
 @interface OHContactMatchNominee : NSObject
 
 @property (nonatomic) NSString *valueString;
 @property (nonatomic) OHContact *contact;
+@property (nonatomic) NSUInteger contactIndex;
 
 @end
 
@@ -36,23 +337,360 @@
 
 @end
 
+/**
+ *  Owns the buffers of a compiled query
+ */
+@interface OHFuzzyMatchingQuery : NSObject
+
+- (instancetype)initWithQuery:(NSString *)query;
+
+@property (nonatomic, readonly) NSString *foldedQuery;
+@property (nonatomic, readonly) NSData *characters;
+@property (nonatomic, readonly) NSData *asciiCharacters;
+@property (nonatomic, readonly) NSData *tokenEnds;
+@property (nonatomic, readonly) OHFuzzyMatchingPattern pattern;
+
+@end
+
+@implementation OHFuzzyMatchingQuery
+
+- (instancetype)initWithQuery:(NSString *)query
+{
+    if (self = [super init]) {
+        NSString *foldedQuery = OHFuzzyMatchingFoldedString(query);
+        NSUInteger length = foldedQuery.length;
+        NSMutableData *characters = [[NSMutableData alloc] initWithLength:length * sizeof(unichar)];
+        [foldedQuery getCharacters:characters.mutableBytes range:NSMakeRange(0, length)];
+
+        NSMutableData *tokenEnds = [[NSMutableData alloc] initWithCapacity:length * sizeof(uint32_t)];
+        [foldedQuery enumerateSubstringsInRange:NSMakeRange(0, length)
+                                        options:NSStringEnumerationByComposedCharacterSequences | NSStringEnumerationSubstringNotRequired
+                                     usingBlock:^(NSString *substring, NSRange substringRange, NSRange enclosingRange, BOOL *stop) {
+                                         uint32_t tokenEnd = (uint32_t)NSMaxRange(substringRange);
+                                         [tokenEnds appendBytes:&tokenEnd length:sizeof(tokenEnd)];
+                                     }];
+
+        const unichar *queryCharacters = characters.bytes;
+        NSMutableData *asciiCharacters = [[NSMutableData alloc] initWithLength:length];
+        uint8_t *asciiBytes = asciiCharacters.mutableBytes;
+        for (NSUInteger i = 0; i < length && asciiCharacters; i++) {
+            if (queryCharacters[i] < 0x80) {
+                asciiBytes[i] = (uint8_t)queryCharacters[i];
+            } else {
+                asciiCharacters = nil;
+            }
+        }
+
+        _foldedQuery = foldedQuery;
+        _characters = characters;
+        _asciiCharacters = asciiCharacters;
+        _tokenEnds = tokenEnds;
+        _pattern = (OHFuzzyMatchingPattern){
+            .characters = characters.bytes,
+            .asciiCharacters = asciiCharacters.bytes,
+            .tokenEnds = tokenEnds.bytes,
+            .tokenCount = tokenEnds.length / sizeof(uint32_t),
+            .length = length
+        };
+    }
+    return self;
+}
+
+@end
+
+static void OHFuzzyMatchingAppendVarint(NSMutableData *data, uint32_t value)
+{
+    uint8_t bytes[5];
+    NSUInteger length = 0;
+    while (value >= 0x80) {
+        bytes[length++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    bytes[length++] = (uint8_t)value;
+    [data appendBytes:bytes length:length];
+}
+
+static uint32_t OHFuzzyMatchingReadVarint(const uint8_t **cursor)
+{
+    uint32_t value = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+    do {
+        byte = *(*cursor)++;
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+/**
+ *  Inverted index from each folded UTF-16 code unit to the nominees containing it
+ *
+ *  @discussion A nominee can only match a query if it contains every code unit of the folded query, so intersecting the postings of
+ *  the query's code units gives a superset of the matches. Longer n-grams would not be sound, since the characters of a fuzzy query
+ *  do not have to be adjacent in a match. Postings are ascending nominee indexes, delta encoded as LEB128 varints.
+ */
+@interface OHFuzzyMatchingIndex : NSObject
+
+- (instancetype)initWithNomineeCount:(NSUInteger)nomineeCount nomineeRanges:(NSData *)nomineeRanges foldedASCIICharacters:(NSData *)foldedASCIICharacters foldedCharacters:(NSData *)foldedCharacters;
+
+/**
+ *  Indexes of the nominees containing every code unit of the query, in ascending order
+ */
+- (NSData *)candidateNomineeIndexesForQuery:(OHFuzzyMatchingQuery *)query;
+
+/**
+ *  Size of the keys, offsets and postings in bytes
+ */
+@property (nonatomic, readonly) NSUInteger size;
+
+@end
+
+@interface OHFuzzyMatchingIndex ()
+
+@property (nonatomic) NSData *keys;             // unichar, ascending
+@property (nonatomic) NSData *postingOffsets;   // uint32_t, one more than there are keys
+@property (nonatomic) NSData *postingCounts;    // uint32_t
+@property (nonatomic) NSData *postings;
+
+@end
+
+@implementation OHFuzzyMatchingIndex
+
+- (instancetype)initWithNomineeCount:(NSUInteger)nomineeCount nomineeRanges:(NSData *)nomineeRanges foldedASCIICharacters:(NSData *)foldedASCIICharacters foldedCharacters:(NSData *)foldedCharacters
+{
+    if (self = [super init]) {
+        const OHFuzzyMatchingNomineeRange *ranges = nomineeRanges.bytes;
+        const uint8_t *asciiCharacters = foldedASCIICharacters.bytes;
+        const unichar *characters = foldedCharacters.bytes;
+
+        // Postings are built per code unit, with the last nominee added to each to skip repeated code units
+        NSMutableDictionary<NSNumber *, NSMutableData *> *postingsByKey = [[NSMutableDictionary alloc] init];
+        uint32_t *lastNomineeIndexes = calloc(UINT16_MAX + 1, sizeof(uint32_t));
+        NSMutableData *asciiPostings[128] = {nil};
+
+        for (uint32_t nomineeIndex = 0; nomineeIndex < nomineeCount; nomineeIndex++) {
+            OHFuzzyMatchingNomineeRange range = ranges[nomineeIndex];
+            for (uint32_t i = 0; i < range.length; i++) {
+                unichar key = range.isASCII ? asciiCharacters[range.offset + i] : characters[range.offset + i];
+                // Indexes are stored plus one so that 0 means no nominee yet
+                uint32_t lastNomineeIndex = lastNomineeIndexes[key];
+                if (lastNomineeIndex == nomineeIndex + 1) {
+                    continue;
+                }
+                NSMutableData *posting = key < 128 ? asciiPostings[key] : [postingsByKey objectForKey:@(key)];
+                if (!posting) {
+                    posting = [[NSMutableData alloc] init];
+                    if (key < 128) {
+                        asciiPostings[key] = posting;
+                    }
+                    [postingsByKey setObject:posting forKey:@(key)];
+                }
+                OHFuzzyMatchingAppendVarint(posting, lastNomineeIndex ? nomineeIndex + 1 - lastNomineeIndex : nomineeIndex);
+                lastNomineeIndexes[key] = nomineeIndex + 1;
+            }
+        }
+
+        NSArray<NSNumber *> *sortedKeys = [postingsByKey.allKeys sortedArrayUsingSelector:@selector(compare:)];
+        NSMutableData *keys = [[NSMutableData alloc] initWithLength:sortedKeys.count * sizeof(unichar)];
+        NSMutableData *postingOffsets = [[NSMutableData alloc] initWithLength:(sortedKeys.count + 1) * sizeof(uint32_t)];
+        NSMutableData *postingCounts = [[NSMutableData alloc] initWithLength:sortedKeys.count * sizeof(uint32_t)];
+        NSMutableData *postings = [[NSMutableData alloc] init];
+        unichar *keyBytes = keys.mutableBytes;
+        uint32_t *offsets = postingOffsets.mutableBytes;
+        uint32_t *counts = postingCounts.mutableBytes;
+        [sortedKeys enumerateObjectsUsingBlock:^(NSNumber *key, NSUInteger keyIndex, BOOL *stop) {
+            NSData *posting = [postingsByKey objectForKey:key];
+            keyBytes[keyIndex] = key.unsignedShortValue;
+            offsets[keyIndex] = (uint32_t)postings.length;
+            [postings appendData:posting];
+        }];
+        offsets[sortedKeys.count] = (uint32_t)postings.length;
+
+        // Counts are recovered by decoding once, which is cheaper than tracking them per key while building
+        const uint8_t *postingBytes = postings.bytes;
+        for (NSUInteger keyIndex = 0; keyIndex < sortedKeys.count; keyIndex++) {
+            const uint8_t *cursor = postingBytes + offsets[keyIndex];
+            const uint8_t *end = postingBytes + offsets[keyIndex + 1];
+            uint32_t count = 0;
+            while (cursor < end) {
+                OHFuzzyMatchingReadVarint(&cursor);
+                count++;
+            }
+            counts[keyIndex] = count;
+        }
+        free(lastNomineeIndexes);
+
+        _keys = keys;
+        _postingOffsets = postingOffsets;
+        _postingCounts = postingCounts;
+        _postings = postings;
+    }
+    return self;
+}
+
+- (NSUInteger)size
+{
+    return self.keys.length + self.postingOffsets.length + self.postingCounts.length + self.postings.length;
+}
+
+- (NSData *)candidateNomineeIndexesForQuery:(OHFuzzyMatchingQuery *)query
+{
+    const unichar *keys = self.keys.bytes;
+    NSUInteger keyCount = self.keys.length / sizeof(unichar);
+    const uint32_t *counts = self.postingCounts.bytes;
+
+    // Key indexes of the distinct code units of the query, rarest first
+    NSMutableIndexSet *keyIndexSet = [[NSMutableIndexSet alloc] init];
+    const unichar *queryCharacters = query.characters.bytes;
+    NSUInteger queryLength = query.characters.length / sizeof(unichar);
+    for (NSUInteger i = 0; i < queryLength; i++) {
+        NSUInteger low = 0;
+        NSUInteger high = keyCount;
+        while (low < high) {
+            NSUInteger middle = (low + high) / 2;
+            if (keys[middle] < queryCharacters[i]) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        if (low == keyCount || keys[low] != queryCharacters[i]) {
+            return [NSData data];
+        }
+        [keyIndexSet addIndex:low];
+    }
+    NSMutableArray<NSNumber *> *keyIndexes = [[NSMutableArray alloc] initWithCapacity:keyIndexSet.count];
+    [keyIndexSet enumerateIndexesUsingBlock:^(NSUInteger keyIndex, BOOL *stop) {
+        [keyIndexes addObject:@(keyIndex)];
+    }];
+    [keyIndexes sortUsingComparator:^NSComparisonResult(NSNumber *keyIndex1, NSNumber *keyIndex2) {
+        uint32_t count1 = counts[keyIndex1.unsignedIntegerValue];
+        uint32_t count2 = counts[keyIndex2.unsignedIntegerValue];
+        return count1 < count2 ? NSOrderedAscending : (count1 > count2 ? NSOrderedDescending : NSOrderedSame);
+    }];
+
+    NSUInteger firstKeyIndex = keyIndexes.firstObject.unsignedIntegerValue;
+    NSMutableData *candidates = [[NSMutableData alloc] initWithLength:counts[firstKeyIndex] * sizeof(uint32_t)];
+    uint32_t *candidateIndexes = candidates.mutableBytes;
+    NSUInteger candidateCount = [self _decodePostingAtKeyIndex:firstKeyIndex intoNomineeIndexes:candidateIndexes];
+
+    for (NSUInteger i = 1; i < keyIndexes.count && candidateCount; i++) {
+        candidateCount = [self _intersectPostingAtKeyIndex:[keyIndexes objectAtIndex:i].unsignedIntegerValue withNomineeIndexes:candidateIndexes count:candidateCount];
+    }
+    candidates.length = candidateCount * sizeof(uint32_t);
+    return candidates;
+}
+
+#pragma mark - Private
+
+- (NSUInteger)_decodePostingAtKeyIndex:(NSUInteger)keyIndex intoNomineeIndexes:(uint32_t *)nomineeIndexes
+{
+    const uint32_t *offsets = self.postingOffsets.bytes;
+    const uint8_t *cursor = (const uint8_t *)self.postings.bytes + offsets[keyIndex];
+    const uint8_t *end = (const uint8_t *)self.postings.bytes + offsets[keyIndex + 1];
+    NSUInteger count = 0;
+    uint32_t nomineeIndex = 0;
+    while (cursor < end) {
+        nomineeIndex += OHFuzzyMatchingReadVarint(&cursor);
+        nomineeIndexes[count++] = nomineeIndex;
+    }
+    return count;
+}
+
+/**
+ *  Keeps the nominee indexes that are also in the posting, in place, and returns how many are left
+ */
+- (NSUInteger)_intersectPostingAtKeyIndex:(NSUInteger)keyIndex withNomineeIndexes:(uint32_t *)nomineeIndexes count:(NSUInteger)count
+{
+    const uint32_t *offsets = self.postingOffsets.bytes;
+    const uint8_t *cursor = (const uint8_t *)self.postings.bytes + offsets[keyIndex];
+    const uint8_t *end = (const uint8_t *)self.postings.bytes + offsets[keyIndex + 1];
+    NSUInteger keptCount = 0;
+    NSUInteger i = 0;
+    uint32_t postingNomineeIndex = 0;
+    while (cursor < end && i < count) {
+        postingNomineeIndex += OHFuzzyMatchingReadVarint(&cursor);
+        while (i < count && nomineeIndexes[i] < postingNomineeIndex) {
+            i++;
+        }
+        if (i < count && nomineeIndexes[i] == postingNomineeIndex) {
+            nomineeIndexes[keptCount++] = postingNomineeIndex;
+            i++;
+        }
+    }
+    return keptCount;
+}
+
+@end
+
+/**
+ *  Earlier query of the search session and the indexes of the nominees that matched it
+ */
+@interface OHFuzzyMatchingSessionEntry : NSObject
+
+@property (nonatomic) NSString *foldedQuery;
+@property (nonatomic) NSData *nomineeIndexes;
+
+@end
+
+@implementation OHFuzzyMatchingSessionEntry
+
+@end
+
+static const NSUInteger kOHFuzzyMatchingSessionDepth = 8;
+
 @interface OHFuzzyMatchingUtility ()
 
-@property (nonatomic) NSOrderedSet<OHContactMatchNominee *> *matchNominees;
+@property (nonatomic) NSArray<OHContact *> *contacts;
+@property (nonatomic) NSArray<OHContactMatchNominee *> *matchNominees;
+
+/**
+ *  Folded values of the nominees, ASCII values narrowed to bytes and the others as UTF-16, indexed by nomineeRanges
+ */
+@property (nonatomic) NSData *nomineeRanges;
+@property (nonatomic) NSData *foldedASCIICharacters;
+@property (nonatomic) NSData *foldedCharacters;
+
+/**
+ *  Built-in scoring bonus of each folded character, indexed by the bonusOffset of nomineeRanges
+ */
+@property (nonatomic) NSData *characterBonuses;
+
+/**
+ *  Stack of earlier queries, each extending the one below it, only accessed while synchronized on self
+ */
+@property (nonatomic) NSMutableArray<OHFuzzyMatchingSessionEntry *> *sessionEntries;
+
+@property (nonatomic, readwrite) OHFuzzyMatchingIndexingMode indexingMode;
+
+/**
+ *  Index of the nominees, nil until it is built, only accessed while synchronized on self
+ */
+@property (nonatomic, nullable) OHFuzzyMatchingIndex *index;
+@property (nonatomic, readwrite) NSTimeInterval indexBuildDuration;
 
 @end
 
 @implementation OHFuzzyMatchingUtility
 
 - (instancetype)initWithContacts:(NSOrderedSet<OHContact *> *)contacts
+{
+    return [self initWithContacts:contacts indexingMode:OHFuzzyMatchingIndexingModeNone];
+}
+
+- (instancetype)initWithContacts:(NSOrderedSet<OHContact *> *)contacts indexingMode:(OHFuzzyMatchingIndexingMode)indexingMode
 {
     if (self = [super init]) {
-        NSMutableOrderedSet<OHContactMatchNominee *> *matchNominees = [[NSMutableOrderedSet<OHContactMatchNominee *> alloc] init];
+        _indexingMode = indexingMode;
+        NSMutableArray<OHContactMatchNominee *> *matchNominees = [[NSMutableArray<OHContactMatchNominee *> alloc] init];
+        NSUInteger contactIndex = 0;
         for (OHContact *contact in contacts) {
             if (contact.fullName.length) {
                 OHContactMatchNominee *matchNominee = [[OHContactMatchNominee alloc] init];
                 matchNominee.valueString = contact.fullName;
                 matchNominee.contact = contact;
+                matchNominee.contactIndex = contactIndex;
                 [matchNominees addObject:matchNominee];
             }
 
@@ -61,60 +699,266 @@
                     OHContactMatchNominee *matchNominee = [[OHContactMatchNominee alloc] init];
                     matchNominee.valueString = contactField.value;
                     matchNominee.contact = contact;
+                    matchNominee.contactIndex = contactIndex;
                     [matchNominees addObject:matchNominee];
                 }
             }
+            contactIndex++;
         }
+        self.contacts = [[contacts copy] array];
         self.matchNominees = matchNominees;
+        self.sessionEntries = [[NSMutableArray<OHFuzzyMatchingSessionEntry *> alloc] init];
+        [self _foldMatchNominees];
+
+        switch (indexingMode) {
+            case OHFuzzyMatchingIndexingModeInline:
+                [self _buildIndex];
+                break;
+            case OHFuzzyMatchingIndexingModeBackground: {
+                dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0), ^{
+                    [self _buildIndex];
+                });
+                break;
+            }
+            case OHFuzzyMatchingIndexingModeNone:
+                break;
+        }
     }
     return self;
 }
 
-- (NSOrderedSet<OHContact *> *)contactsMatchingQuery:(NSString *)originalQuery
+- (BOOL)isIndexReady
+{
+    @synchronized(self) {
+        return self.index != nil;
+    }
+}
+
+- (NSUInteger)indexSize
+{
+    @synchronized(self) {
+        return self.index.size;
+    }
+}
+
+- (NSOrderedSet<OHContact *> *)contactsMatchingQuery:(NSString *)query
+{
+    return [self contactsMatchingQuery:query limit:0];
+}
+
+- (NSOrderedSet<OHContact *> *)contactsMatchingQuery:(NSString *)originalQuery limit:(NSUInteger)limit
 {
     if (!originalQuery.length) {
         return nil;
     }
 
-    NSString *query = [self _fuzzyQueryFromQuery:originalQuery];
+    OHFuzzyMatchingQuery *query = [[OHFuzzyMatchingQuery alloc] initWithQuery:originalQuery];
+    NSData *matchingNomineeIndexes = [self _matchingNomineeIndexesForQuery:query];
+    const uint32_t *nomineeIndexes = matchingNomineeIndexes.bytes;
+    NSUInteger matchCount = matchingNomineeIndexes.length / sizeof(uint32_t);
+
+    OHFuzzyScoringBlock scoringBlock = self.scoringBlock;
+    BOOL usesBuiltInScoring = !scoringBlock && self.usesBuiltInScoring;
+    OHFuzzyMatchingPattern pattern = query.pattern;
+    const OHFuzzyMatchingNomineeRange *nomineeRanges = self.nomineeRanges.bytes;
+    const uint8_t *foldedASCIICharacters = self.foldedASCIICharacters.bytes;
+    const unichar *foldedCharacters = self.foldedCharacters.bytes;
+    const uint8_t *characterBonuses = self.characterBonuses.bytes;
+
+    // Without a limit every matching contact is kept and sorted, with one only the best limit contacts are kept in a heap
+    NSUInteger capacity = limit ? MIN(limit, matchCount) : matchCount;
+    NSMutableData *rankedContactsData = [[NSMutableData alloc] initWithLength:MAX(capacity, 1) * sizeof(OHFuzzyMatchingRankedContact)];
+    OHFuzzyMatchingRankedContact *rankedContacts = rankedContactsData.mutableBytes;
+    NSUInteger rankedContactCount = 0;
 
-    NSUInteger index = 0;
-    NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern:query options:NSRegularExpressionCaseInsensitive error:NULL];
-    NSMapTable<OHContact *, NSNumber *> *contactScores = [[NSMapTable<OHContact *, NSNumber *> alloc] initWithKeyOptions:NSMapTableStrongMemory valueOptions:NSMapTableStrongMemory capacity:self.matchNominees.count];
-    for (OHContactMatchNominee *nominee in self.matchNominees) {
-        if ([regex firstMatchInString:nominee.valueString options:0 range:NSMakeRange(0, nominee.valueString.length)]) {
-            if (self.scoringBlock) {
-                NSInteger score = self.scoringBlock(originalQuery, nominee.valueString);
-                NSNumber *existingScore = [contactScores objectForKey:nominee.contact];
-                if (!existingScore || score > [existingScore integerValue]) {
-                    [contactScores setObject:@(score) forKey:nominee.contact];
+    // The nominees of a contact are consecutive, so each contact's best score is complete once a match of another contact is seen
+    OHFuzzyMatchingRankedContact rankedContact = {0, 0};
+    BOOL hasRankedContact = NO;
+    for (NSUInteger i = 0; i < matchCount; i++) {
+        OHFuzzyMatchingNomineeRange range = nomineeRanges[nomineeIndexes[i]];
+        NSInteger score = 0;
+        if (scoringBlock) {
+            score = scoringBlock(originalQuery, [self.matchNominees objectAtIndex:nomineeIndexes[i]].valueString);
+        } else if (usesBuiltInScoring) {
+            score = OHFuzzyMatchingScoreNominee(&pattern, range, foldedASCIICharacters, foldedCharacters, characterBonuses);
+        }
+
+        if (hasRankedContact && rankedContact.contactIndex == range.contactIndex) {
+            rankedContact.score = MAX(rankedContact.score, score);
+        } else {
+            if (hasRankedContact) {
+                if (limit) {
+                    OHFuzzyMatchingHeapPush(rankedContacts, &rankedContactCount, limit, rankedContact);
+                } else {
+                    rankedContacts[rankedContactCount++] = rankedContact;
                 }
-            } else {
-                [contactScores setObject:@(index++) forKey:nominee.contact];
             }
+            rankedContact = (OHFuzzyMatchingRankedContact){score, range.contactIndex};
+            hasRankedContact = YES;
         }
     }
-
-    return [NSOrderedSet orderedSetWithArray:[[[contactScores keyEnumerator] allObjects] sortedArrayUsingComparator:^NSComparisonResult(OHContact *obj1, OHContact *obj2) {
-        if (self.scoringBlock) {
-            return [[contactScores objectForKey:obj2] compare:[contactScores objectForKey:obj1]];
+    if (hasRankedContact) {
+        if (limit) {
+            OHFuzzyMatchingHeapPush(rankedContacts, &rankedContactCount, limit, rankedContact);
         } else {
-            return [[contactScores objectForKey:obj1] compare:[contactScores objectForKey:obj2]];
+            rankedContacts[rankedContactCount++] = rankedContact;
         }
-    }]];
+    }
+
+    if (scoringBlock || usesBuiltInScoring || limit) {
+        qsort(rankedContacts, rankedContactCount, sizeof(OHFuzzyMatchingRankedContact), OHFuzzyMatchingCompareRankedContacts);
+    }
+
+    NSMutableOrderedSet<OHContact *> *contacts = [[NSMutableOrderedSet<OHContact *> alloc] initWithCapacity:rankedContactCount];
+    for (NSUInteger i = 0; i < rankedContactCount; i++) {
+        [contacts addObject:[self.contacts objectAtIndex:rankedContacts[i].contactIndex]];
+    }
+    return contacts;
+}
+
+- (void)resetSearchSession
+{
+    @synchronized(self) {
+        [self.sessionEntries removeAllObjects];
+    }
 }
 
 #pragma mark - Private
 
-- (NSString *)_fuzzyQueryFromQuery:(NSString *)query
+/**
+ *  Returns the indexes of the nominees matching the query, in ascending order
+ *
+ *  @discussion Any nominee matching a query also matches every query its folded query extends, so only the nominees that matched
+ *  the longest earlier query the new one extends are searched. Queries that shorten the previous one are answered from the stack
+ *  when they were searched before.
+ */
+- (NSData *)_matchingNomineeIndexesForQuery:(OHFuzzyMatchingQuery *)query
+{
+    @synchronized(self) {
+        OHFuzzyMatchingSessionEntry *entry = self.sessionEntries.lastObject;
+        while (entry && [query.foldedQuery rangeOfString:entry.foldedQuery options:NSLiteralSearch | NSAnchoredSearch].location == NSNotFound) {
+            [self.sessionEntries removeLastObject];
+            entry = self.sessionEntries.lastObject;
+        }
+        if ([entry.foldedQuery isEqualToString:query.foldedQuery]) {
+            return entry.nomineeIndexes;
+        }
+
+        NSData *candidateNomineeIndexes = entry.nomineeIndexes ?: [self.index candidateNomineeIndexesForQuery:query];
+        NSData *nomineeIndexes = [self _nomineeIndexesMatchingQuery:query amongNomineeIndexes:candidateNomineeIndexes];
+
+        OHFuzzyMatchingSessionEntry *newEntry = [[OHFuzzyMatchingSessionEntry alloc] init];
+        newEntry.foldedQuery = query.foldedQuery;
+        newEntry.nomineeIndexes = nomineeIndexes;
+        [self.sessionEntries addObject:newEntry];
+        if (self.sessionEntries.count > kOHFuzzyMatchingSessionDepth) {
+            [self.sessionEntries removeObjectAtIndex:0];
+        }
+        return nomineeIndexes;
+    }
+}
+
+/**
+ *  @param candidateNomineeIndexes Indexes of the nominees to search, or nil to search all nominees
+ */
+- (NSData *)_nomineeIndexesMatchingQuery:(OHFuzzyMatchingQuery *)query amongNomineeIndexes:(nullable NSData *)candidateNomineeIndexes
+{
+    OHFuzzyMatchingPattern pattern = query.pattern;
+    const OHFuzzyMatchingNomineeRange *nomineeRanges = self.nomineeRanges.bytes;
+    const uint8_t *foldedASCIICharacters = self.foldedASCIICharacters.bytes;
+    const unichar *foldedCharacters = self.foldedCharacters.bytes;
+
+    NSMutableData *nomineeIndexes = [[NSMutableData alloc] init];
+    if (candidateNomineeIndexes) {
+        const uint32_t *candidates = candidateNomineeIndexes.bytes;
+        NSUInteger candidateCount = candidateNomineeIndexes.length / sizeof(uint32_t);
+        for (NSUInteger i = 0; i < candidateCount; i++) {
+            if (OHFuzzyMatchingPatternMatchesNominee(&pattern, nomineeRanges[candidates[i]], foldedASCIICharacters, foldedCharacters)) {
+                [nomineeIndexes appendBytes:&candidates[i] length:sizeof(uint32_t)];
+            }
+        }
+    } else {
+        for (uint32_t nomineeIndex = 0; nomineeIndex < self.matchNominees.count; nomineeIndex++) {
+            if (OHFuzzyMatchingPatternMatchesNominee(&pattern, nomineeRanges[nomineeIndex], foldedASCIICharacters, foldedCharacters)) {
+                [nomineeIndexes appendBytes:&nomineeIndex length:sizeof(uint32_t)];
+            }
+        }
+    }
+    return nomineeIndexes;
+}
+
+- (void)_buildIndex
+{
+    CFAbsoluteTime startTime = CFAbsoluteTimeGetCurrent();
+    OHFuzzyMatchingIndex *index = [[OHFuzzyMatchingIndex alloc] initWithNomineeCount:self.matchNominees.count
+                                                                       nomineeRanges:self.nomineeRanges
+                                                               foldedASCIICharacters:self.foldedASCIICharacters
+                                                                    foldedCharacters:self.foldedCharacters];
+    NSTimeInterval buildDuration = CFAbsoluteTimeGetCurrent() - startTime;
+    @synchronized(self) {
+        self.indexBuildDuration = buildDuration;
+        self.index = index;
+    }
+}
+
+- (void)_foldMatchNominees
 {
-    NSMutableArray *characters = [[NSMutableArray alloc] initWithCapacity:[query length]];
-    [query enumerateSubstringsInRange:NSMakeRange(0, query.length)
-                              options:NSStringEnumerationByComposedCharacterSequences
-                           usingBlock:^(NSString *substring, NSRange substringRange, NSRange enclosingRange, BOOL *stop) {
-                               [characters addObject:substring];
-                           }];
-    return [characters componentsJoinedByString:@".*?"];
+    NSMutableData *nomineeRanges = [[NSMutableData alloc] initWithLength:self.matchNominees.count * sizeof(OHFuzzyMatchingNomineeRange)];
+    NSMutableData *foldedASCIICharacters = [[NSMutableData alloc] init];
+    NSMutableData *foldedCharacters = [[NSMutableData alloc] init];
+    NSMutableData *characterBonuses = [[NSMutableData alloc] init];
+    NSMutableData *buffer = [[NSMutableData alloc] init];
+    NSMutableData *originalBuffer = [[NSMutableData alloc] init];
+
+    OHFuzzyMatchingNomineeRange *ranges = nomineeRanges.mutableBytes;
+    for (NSUInteger nomineeIndex = 0; nomineeIndex < self.matchNominees.count; nomineeIndex++) {
+        OHContactMatchNominee *matchNominee = [self.matchNominees objectAtIndex:nomineeIndex];
+        NSString *foldedValue = OHFuzzyMatchingFoldedString(matchNominee.valueString);
+        NSUInteger length = foldedValue.length;
+        buffer.length = length * sizeof(unichar);
+        unichar *characters = buffer.mutableBytes;
+        [foldedValue getCharacters:characters range:NSMakeRange(0, length)];
+
+        // Camel case humps are only visible in the original value, which lines up with the folded one unless folding changed its length
+        const unichar *classifiedCharacters = characters;
+        if (matchNominee.valueString.length == length) {
+            originalBuffer.length = length * sizeof(unichar);
+            [matchNominee.valueString getCharacters:originalBuffer.mutableBytes range:NSMakeRange(0, length)];
+            classifiedCharacters = originalBuffer.bytes;
+        }
+        uint32_t bonusOffset = (uint32_t)characterBonuses.length;
+        characterBonuses.length += length;
+        uint8_t *bonuses = (uint8_t *)characterBonuses.mutableBytes + bonusOffset;
+        OHFuzzyMatchingCharacterClass previousClass = OHFuzzyMatchingCharacterClassWhite;
+        for (NSUInteger i = 0; i < length; i++) {
+            OHFuzzyMatchingCharacterClass characterClass = OHFuzzyMatchingClassOfCharacter(classifiedCharacters[i]);
+            bonuses[i] = OHFuzzyMatchingBonus(previousClass, characterClass);
+            previousClass = characterClass;
+        }
+
+        BOOL isASCII = YES;
+        for (NSUInteger i = 0; i < length && isASCII; i++) {
+            isASCII = characters[i] < 0x80;
+        }
+
+        if (isASCII) {
+            ranges[nomineeIndex] = (OHFuzzyMatchingNomineeRange){(uint32_t)foldedASCIICharacters.length, (uint32_t)length, bonusOffset, (uint32_t)matchNominee.contactIndex, YES};
+            NSUInteger offset = foldedASCIICharacters.length;
+            foldedASCIICharacters.length += length;
+            uint8_t *asciiCharacters = (uint8_t *)foldedASCIICharacters.mutableBytes + offset;
+            for (NSUInteger i = 0; i < length; i++) {
+                asciiCharacters[i] = (uint8_t)characters[i];
+            }
+        } else {
+            ranges[nomineeIndex] = (OHFuzzyMatchingNomineeRange){(uint32_t)(foldedCharacters.length / sizeof(unichar)), (uint32_t)length, bonusOffset, (uint32_t)matchNominee.contactIndex, NO};
+            [foldedCharacters appendBytes:characters length:length * sizeof(unichar)];
+        }
+    }
+
+    self.nomineeRanges = nomineeRanges;
+    self.foldedASCIICharacters = foldedASCIICharacters;
+    self.foldedCharacters = foldedCharacters;
+    self.characterBonuses = characterBonuses;
 }
 
 @end
@@ -0,0 +1,93 @@
+//
+//  OHPhoneNumberService.h
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_OPTIONS (NSInteger, OHPhoneNumberFormat) {
+    OHPhoneNumberFormatE164             = 1 << 0,
+    OHPhoneNumberFormatInternational    = 1 << 1,
+    OHPhoneNumberFormatNational         = 1 << 2,
+    OHPhoneNumberFormatRFC3966          = 1 << 3,
+};
+
+/**
+ *  Process wide service that parses and formats phone numbers with libPhoneNumber
+ *
+ *  @discussion All callers share one set of phone number metadata, and parsed and formatted numbers are cached by their
+ *  raw string and default region, so numbers shared between contacts and numbers seen again on a reload are only
+ *  parsed and formatted once. The cache is purged under memory pressure. The service is safe to use from any thread.
+ */
+@interface OHPhoneNumberService : NSObject
+
+/**
+ *  The shared phone number service
+ */
++ (instancetype)sharedService;
+
+/**
+ *  Region code of the current locale, for example "US", or nil if the locale has no region
+ */
++ (nullable NSString *)currentRegion;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  Loads the phone number metadata for a region on a background queue
+ *
+ *  @discussion Formatting calls made while the metadata is still loading wait for it rather than loading it again.
+ *
+ *  @param region Region to load metadata for, or nil for the current region
+ */
+- (void)prewarmForRegion:(nullable NSString *)region;
+
+/**
+ *  Returns the phone number in a single format, or nil if it cannot be parsed or formatted
+ *
+ *  @param format Exactly one format
+ *  @param region Region used for numbers without a country code, or nil for the current region
+ */
+- (nullable NSString *)formattedPhoneNumber:(NSString *)phoneNumber format:(OHPhoneNumberFormat)format defaultRegion:(nullable NSString *)region;
+
+/**
+ *  Returns the phone number in each of the requested formats, keyed by format
+ *
+ *  @discussion Formats the number cannot be formatted in are missing from the result, which is empty if the number
+ *  cannot be parsed at all.
+ *
+ *  @param formats Bit mask of formats
+ *  @param region Region used for numbers without a country code, or nil for the current region
+ */
+- (NSDictionary<NSNumber *, NSString *> *)formattedPhoneNumbers:(NSString *)phoneNumber formats:(OHPhoneNumberFormat)formats defaultRegion:(nullable NSString *)region;
+
+/**
+ *  Drops all cached parsed and formatted phone numbers
+ */
+- (void)removeAllCachedPhoneNumbers;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,198 @@
+//
+//  OHPhoneNumberService.m
+//  Ohana
+//
+//  Copyright (c) 2016 Uber Technologies, Inc.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#import "OHPhoneNumberService.h"
+
+// This imports libPhoneNumber-iOS if using libraries
+#if __has_include(<libPhoneNumber-iOS/NBPhoneNumberUtil.h>)
+#import <libPhoneNumber-iOS/NBPhoneNumberUtil.h>
+#elif __has_include(<libPhoneNumber_iOS/NBPhoneNumberUtil.h>)
+#import <libPhoneNumber_iOS/NBPhoneNumberUtil.h>
+#endif
+
+/**
+ *  Cached parse result of one raw phone number in one default region
+ */
+@interface OHPhoneNumberServiceEntry : NSObject
+
+@property (nonatomic, nullable) NBPhoneNumber *phoneNumber;
+
+/**
+ *  Formatted phone numbers keyed by format, with NSNull for formats the phone number could not be formatted in
+ */
+@property (nonatomic) NSMutableDictionary<NSNumber *, id> *formattedPhoneNumbers;
+
+@end
+
+@implementation OHPhoneNumberServiceEntry
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _formattedPhoneNumbers = [[NSMutableDictionary alloc] init];
+    }
+    return self;
+}
+
+@end
+
+@interface OHPhoneNumberService ()
+
+@property (nonatomic) dispatch_queue_t phoneNumberQueue;
+
+@property (nonatomic, nullable) NBPhoneNumberUtil *phoneNumberUtil;
+
+@property (nonatomic) NSCache<NSString *, OHPhoneNumberServiceEntry *> *entries;
+
+@end
+
+@implementation OHPhoneNumberService
+
+static const NSUInteger kOHPhoneNumberServiceCacheCountLimit = 20000;
+
++ (instancetype)sharedService
+{
+    static OHPhoneNumberService *sharedService;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedService = [[OHPhoneNumberService alloc] _init];
+    });
+    return sharedService;
+}
+
++ (NSString *)currentRegion
+{
+    return [[[NSLocale currentLocale] objectForKey:NSLocaleCountryCode] uppercaseString];
+}
+
+- (instancetype)_init
+{
+    if (self = [super init]) {
+        _phoneNumberQueue = dispatch_queue_create("com.uber.ohana.phonenumberservice", DISPATCH_QUEUE_SERIAL);
+        _entries = [[NSCache alloc] init];
+        _entries.countLimit = kOHPhoneNumberServiceCacheCountLimit;
+    }
+    return self;
+}
+
+- (void)prewarmForRegion:(NSString *)region
+{
+    NSString *prewarmRegion = region ?: [OHPhoneNumberService currentRegion];
+    dispatch_async(self.phoneNumberQueue, ^{
+        NBPhoneNumberUtil *phoneNumberUtil = [self _phoneNumberUtil];
+        if (prewarmRegion.length) {
+            // Looking up an example number loads the metadata of the region
+            [phoneNumberUtil getExampleNumber:prewarmRegion error:nil];
+        }
+    });
+}
+
+- (NSString *)formattedPhoneNumber:(NSString *)phoneNumber format:(OHPhoneNumberFormat)format defaultRegion:(NSString *)region
+{
+    return [[self formattedPhoneNumbers:phoneNumber formats:format defaultRegion:region] objectForKey:@(format)];
+}
+
+- (NSDictionary<NSNumber *, NSString *> *)formattedPhoneNumbers:(NSString *)phoneNumber formats:(OHPhoneNumberFormat)formats defaultRegion:(NSString *)region
+{
+    NSString *defaultRegion = region ?: [OHPhoneNumberService currentRegion];
+    NSMutableDictionary<NSNumber *, NSString *> *formattedPhoneNumbers = [[NSMutableDictionary alloc] init];
+    dispatch_sync(self.phoneNumberQueue, ^{
+        OHPhoneNumberServiceEntry *entry = [self _entryForPhoneNumber:phoneNumber defaultRegion:defaultRegion];
+        if (!entry.phoneNumber) {
+            return;
+        }
+        for (NSNumber *format in @[@(OHPhoneNumberFormatE164), @(OHPhoneNumberFormatInternational), @(OHPhoneNumberFormatNational), @(OHPhoneNumberFormatRFC3966)]) {
+            if (formats & format.integerValue) {
+                id formattedPhoneNumber = [entry.formattedPhoneNumbers objectForKey:format];
+                if (!formattedPhoneNumber) {
+                    NSError *formattingError;
+                    formattedPhoneNumber = [[self _phoneNumberUtil] format:entry.phoneNumber numberFormat:[self _numberFormatForFormat:format.integerValue] error:&formattingError];
+                    if (formattingError || !formattedPhoneNumber) {
+                        formattedPhoneNumber = [NSNull null];
+                    }
+                    [entry.formattedPhoneNumbers setObject:formattedPhoneNumber forKey:format];
+                }
+                if (formattedPhoneNumber != [NSNull null]) {
+                    [formattedPhoneNumbers setObject:formattedPhoneNumber forKey:format];
+                }
+            }
+        }
+    });
+    return formattedPhoneNumbers;
+}
+
+- (void)removeAllCachedPhoneNumbers
+{
+    [self.entries removeAllObjects];
+}
+
+#pragma mark - Private
+
+/**
+ *  Must be called on the phone number queue
+ */
+- (NBPhoneNumberUtil *)_phoneNumberUtil
+{
+    if (!self.phoneNumberUtil) {
+        self.phoneNumberUtil = [[NBPhoneNumberUtil alloc] init];
+    }
+    return self.phoneNumberUtil;
+}
+
+/**
+ *  Must be called on the phone number queue
+ */
+- (OHPhoneNumberServiceEntry *)_entryForPhoneNumber:(NSString *)phoneNumber defaultRegion:(NSString *)defaultRegion
+{
+    NSString *key = [NSString stringWithFormat:@"%@|%@", defaultRegion ?: @"", phoneNumber];
+    OHPhoneNumberServiceEntry *entry = [self.entries objectForKey:key];
+    if (!entry) {
+        entry = [[OHPhoneNumberServiceEntry alloc] init];
+        NSError *error;
+        NBPhoneNumber *parsedPhoneNumber = [[self _phoneNumberUtil] parse:phoneNumber defaultRegion:defaultRegion error:&error];
+        if (!error) {
+            entry.phoneNumber = parsedPhoneNumber;
+        }
+        [self.entries setObject:entry forKey:key];
+    }
+    return entry;
+}
+
+- (NBEPhoneNumberFormat)_numberFormatForFormat:(OHPhoneNumberFormat)format
+{
+    switch (format) {
+        case OHPhoneNumberFormatInternational:
+            return NBEPhoneNumberFormatINTERNATIONAL;
+        case OHPhoneNumberFormatNational:
+            return NBEPhoneNumberFormatNATIONAL;
+        case OHPhoneNumberFormatRFC3966:
+            return NBEPhoneNumberFormatRFC3966;
+        case OHPhoneNumberFormatE164:
+        default:
+            return NBEPhoneNumberFormatE164;
+    }
+}
+
+@end
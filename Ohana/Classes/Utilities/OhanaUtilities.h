@@ -23,4 +23,6 @@
 //  THE SOFTWARE.
 //
 
+#import <Ohana/OHDigitSearchUtility.h>
 #import <Ohana/OHFuzzyMatchingUtility.h>
+#import <Ohana/OHPhoneNumberService.h>